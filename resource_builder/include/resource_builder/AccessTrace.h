@@ -0,0 +1,69 @@
+#ifndef TOOLS_RESOURCE_BUILDER_INCLUDE_ACCESSTRACE_H_
+#define TOOLS_RESOURCE_BUILDER_INCLUDE_ACCESSTRACE_H_
+
+// System headers
+#include <cstdint>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+// Other libraries headers
+#include "utils/ErrorCode.h"
+
+// Own components headers
+
+// Forward declarations
+struct BuilderCombinedData;
+
+/* Holds a runtime access trace recorded by the game - a text file with
+ * one resource hash value per line in first-use order:
+ *
+ *      # comment lines and empty lines are skipped
+ *      0x00000000075BCD15
+ *      00000000075BCD16
+ *
+ * Only the first occurrence of a hash value is taken into account.
+ * The trace is used to reorder the produced entries, so the assets are
+ * laid out in the order they are being requested.
+ * */
+class AccessTrace {
+ public:
+  /** @brief used to load the access trace file
+   *
+   *  @param const std::string & - absolute/relative trace file name
+   *
+   *  @returns ErrorCode         - error code
+   * */
+  ErrorCode load(const std::string& fileName);
+
+  /** @brief used to determine whether a trace was loaded
+   *
+   *  @returns bool - is the trace empty or not
+   * */
+  bool isEmpty() const { return _ranks.empty(); }
+
+  /** @brief used to obtain the first-use position of a hash value
+   *
+   *  @param const uint64_t - resource hash value
+   *
+   *  @returns uint64_t     - first-use position or UNSEEN_RANK
+   * */
+  uint64_t getRank(const uint64_t hashValue) const;
+
+  /** @brief used to reorder entries to match the access trace.
+   *         Entries, which are not present in the trace are placed last,
+   *         preserving their relative order.
+   *
+   *  @param std::vector<BuilderCombinedData> & - entries to reorder
+   * */
+  void sortEntries(std::vector<BuilderCombinedData>& entries) const;
+
+  /* Rank of the entries, which are not present in the trace */
+  static constexpr uint64_t UNSEEN_RANK = UINT64_MAX;
+
+ private:
+  /* hash value -> first-use position */
+  std::unordered_map<uint64_t, uint64_t> _ranks;
+};
+
+#endif /* TOOLS_RESOURCE_BUILDER_INCLUDE_ACCESSTRACE_H_ */
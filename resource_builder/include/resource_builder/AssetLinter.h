@@ -0,0 +1,72 @@
+#ifndef TOOLS_RESOURCE_BUILDER_INCLUDE_ASSETLINTER_H_
+#define TOOLS_RESOURCE_BUILDER_INCLUDE_ASSETLINTER_H_
+
+// System headers
+#include <cstdint>
+#include <string>
+#include <vector>
+
+// Other libraries headers
+
+// Own components headers
+
+// Forward declarations
+struct BuilderCombinedData;
+struct ResourceBuilderConfig;
+
+/* Finds image properties, which make the assets slow to load, from the
+ * information read out of the image headers:
+ *      > progressive JPEGs - every scan is a full decoding pass;
+ *      > Adam7 interlaced PNGs - 7 reduced images are inflated and
+ *        scattered back into the final one;
+ *      > 16 bit per sample PNGs - twice the data is inflated and
+ *        converted down to the 8 bit textures;
+ *      > non power of two images with LODs (the mip chain of the tree) -
+ *        padded by the GPUs, which can not mip them;
+ *      > huge images, where the sprite frames use only a small part -
+ *        the whole image is decoded and uploaded for a few pixels;
+ *
+ * Every finding carries an estimated load cost - the amount of decoded
+ * memory, which is wasted (or processed again) because of it. The report
+ * is sorted by that cost, so the worst offenders come first.
+ * */
+class AssetLinter {
+ public:
+  AssetLinter();
+
+  /** @brief used to set whether the LODs are generated globally
+   *
+   *  @param const ResourceBuilderConfig & - tool configuration
+   * */
+  void init(const ResourceBuilderConfig& config);
+
+  /** @brief used to lint the entries and log the ranked report
+   *
+   *  @param const std::vector<BuilderCombinedData> & - the parsed data
+   *                                                   from all .rsrc files
+   * */
+  void lint(const std::vector<BuilderCombinedData>& data) const;
+
+ private:
+  /* A single load performance hazard */
+  struct Finding {
+    std::string path;
+    std::string description;
+
+    /* Estimated load cost in bytes of decoded memory */
+    uint64_t cost = 0;
+  };
+
+  /** @brief used to append the findings of a single entry
+   *
+   *  @param const BuilderCombinedData & - image entry
+   *  @param std::vector<Finding> &      - all findings
+   * */
+  void lintEntry(const BuilderCombinedData& entry,
+                 std::vector<Finding>& outFindings) const;
+
+  /* Whether every image entry has LODs (the '--lods' option) */
+  bool _hasDefaultLods;
+};
+
+#endif /* TOOLS_RESOURCE_BUILDER_INCLUDE_ASSETLINTER_H_ */
@@ -0,0 +1,75 @@
+#ifndef TOOLS_RESOURCE_BUILDER_INCLUDE_ATOMICFILESTREAM_H_
+#define TOOLS_RESOURCE_BUILDER_INCLUDE_ATOMICFILESTREAM_H_
+
+// System headers
+#include <fstream>
+#include <string>
+
+// Other libraries headers
+#include "utils/ErrorCode.h"
+
+// Own components headers
+
+// Forward declarations
+
+/* An output file stream that never exposes partially written data.
+ *
+ * All the data is written to a temporary file located in the same directory
+ * as the destination file. Once the data is complete the temporary file
+ * is published under the destination name with a single rename.
+ * Readers therefore observe either the previous or the new complete file.
+ *
+ * NOTE: the temporary file lives in the same directory as the destination
+ *       file, because rename is atomic only within a single file system.
+ * */
+class AtomicFileStream : public std::ofstream {
+ public:
+  AtomicFileStream() = default;
+  ~AtomicFileStream() noexcept override;
+
+  AtomicFileStream(const AtomicFileStream&) = delete;
+  AtomicFileStream& operator=(const AtomicFileStream&) = delete;
+
+  /** @brief used to open the temporary file for the provided destination
+   *
+   *  @param const std::string & - destination file name
+   *
+   *  @returns ErrorCode         - error code
+   * */
+  ErrorCode begin(const std::string& fileName);
+
+  /** @brief used to close the temporary file and publish it under
+   *                                           the destination file name.
+   *
+   *         A failed sync of the parent directory after the rename is
+   *         only reported as a warning, since the file is already
+   *         published at that point.
+   *
+   *  @param const bool  - whether the file data should be flushed to the
+   *                       storage device (fsync) before publishing it
+   *
+   *  @returns ErrorCode - error code (on FAILURE the destination file is
+   *                       left untouched)
+   * */
+  ErrorCode publish(const bool syncToDisk);
+
+  /** @brief used to close and remove the temporary file (if any).
+   *         The destination file is left untouched.
+   * */
+  void discard();
+
+  /** @brief used to obtain the destination file name
+   *
+   *  @returns const std::string & - destination file name
+   * */
+  const std::string& getFileName() const { return _fileName; }
+
+ private:
+  /* Destination file name */
+  std::string _fileName;
+
+  /* Temporary file name, where the data is being written */
+  std::string _tempFileName;
+};
+
+#endif /* TOOLS_RESOURCE_BUILDER_INCLUDE_ATOMICFILESTREAM_H_ */
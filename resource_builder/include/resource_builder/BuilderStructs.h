@@ -0,0 +1,174 @@
+#ifndef TOOLS_RESOURCE_BUILDER_INCLUDE_BUILDERSTRUCTS_H_
+#define TOOLS_RESOURCE_BUILDER_INCLUDE_BUILDERSTRUCTS_H_
+
+// System headers
+#include <cstdint>
+#include <string>
+#include <vector>
+
+// Other libraries headers
+#include "resource_utils/structs/CombinedStructs.h"
+
+// Own components headers
+
+// Forward declarations
+
+/* Decoding parameters of a sound file, read from it's header.
+ * Used by the runtime to preallocate exact PCM buffers.
+ * All values are 0 when they are unknown.
+ * */
+struct SoundInfo {
+  uint32_t sampleRate = 0;
+  uint32_t channels = 0;
+
+  /* Bits per PCM sample. 0 for compressed formats (e.g. Ogg Vorbis),
+   * where the decoder defines the output sample format */
+  uint32_t bitsPerSample = 0;
+
+  /* Total samples per channel (sample frames) */
+  uint64_t totalSamples = 0;
+};
+
+/* Metrics of a TrueType/OpenType font, read from it's sfnt tables.
+ * Used by the runtime to preallocate glyph caches and atlases.
+ * All values are in font units, unless stated otherwise.
+ * */
+struct FontInfo {
+  uint32_t unitsPerEm = 0;
+  int32_t ascent = 0;
+  int32_t descent = 0;
+  int32_t lineGap = 0;
+  uint32_t glyphCount = 0;
+  uint32_t advanceWidthMax = 0;
+
+  /* OS/2 xAvgCharWidth. 0 if the OS/2 table is missing */
+  uint32_t avgCharWidth = 0;
+
+  /* Estimated glyph atlas size (in pixels) for the declared fontSize */
+  uint32_t atlasWidth = 0;
+  uint32_t atlasHeight = 0;
+};
+
+/* Container of a GPU compressed texture, which is uploaded as it is
+ * (without CPU decoding) */
+enum class TextureContainer : uint8_t {
+  NONE = 0,  // PNG, JPG or GIF image - decoded at load time
+  KTX2,
+  DDS,
+  ASTC
+};
+
+/* Encoding properties of an image, read from it's header.
+ * Used to find the images, which are slow to decode.
+ * */
+struct ImageInfo {
+  /* Bits per sample (PNG IHDR bit depth or JPEG SOF sample precision).
+   * 0 when unknown */
+  uint32_t bitDepth = 0;
+
+  /* Whether the PNG is Adam7 interlaced */
+  bool interlaced = false;
+
+  /* Whether the JPEG is progressive (SOF2 or SOF10) */
+  bool progressive = false;
+
+  /* Whether the image is a PNG. The fields below are valid only then */
+  bool isPng = false;
+
+  /* PNG 'IHDR' color type: 0 - gray, 2 - RGB, 3 - palette,
+   * 4 - gray with alpha, 6 - RGBA */
+  uint32_t colorType = 0;
+
+  /* Whether a 'tRNS' (transparency) chunk precedes the image data */
+  bool hasTransparency = false;
+
+  /* Whether a 'gAMA' (gamma) chunk precedes the image data */
+  bool hasGamma = false;
+
+  /* GPU compressed texture container. The fields below are valid only
+   * when it is not TextureContainer::NONE */
+  TextureContainer container = TextureContainer::NONE;
+
+  /* Pixel format - VkFormat for .ktx2 and .astc, DXGI_FORMAT for .dds.
+   * 0 for .ktx2 textures, which are transcoded at runtime (Basis) */
+  uint32_t format = 0;
+
+  /* Stored mip levels (the base level included) */
+  uint32_t mipCount = 0;
+
+  /* Array layers (cube map faces are counted as layers) */
+  uint32_t layerCount = 0;
+
+  /* GPU memory of all the mip levels and layers in bytes.
+   * 0 when unknown (supercompressed .ktx2 textures) */
+  uint64_t gpuSize = 0;
+};
+
+/* Tight (non fully transparent) part of a sprite frame */
+struct FrameTrim {
+  /* Trimmed source rectangle within the image.
+   * Empty (w == h == 0) for fully transparent frames */
+  Rectangle rect;
+
+  /* Position of the trimmed rectangle inside the original frame */
+  int32_t offsetX = 0;
+  int32_t offsetY = 0;
+};
+
+/* Extends the shared CombinedData with information, which is needed
+ * only while the resource_builder is producing it's outputs.
+ * */
+struct BuilderCombinedData : public CombinedData {
+  void reset() {
+    CombinedData::reset();
+    absoluteFilePath.clear();
+    contentDigest = 0;
+    fileSize = 0;
+    group.clear();
+    resourceNamespace.clear();
+    soundInfo = SoundInfo();
+    fontInfo = FontInfo();
+    imageInfo = ImageInfo();
+    frameTrims.clear();
+    frameRemap.clear();
+    lodScales.clear();
+  }
+
+  /* Absolute path of the described asset file */
+  std::string absoluteFilePath;
+
+  /* XXH64 (seed 0) of the whole asset file content */
+  uint64_t contentDigest = 0;
+
+  /* Exact asset file size in bytes. It is written to the combined files.
+   * header.fileSize is still populated for the CombinedData consumers
+   * with the legacy truncated kBytes (capped at INT32_MAX) */
+  uint64_t fileSize = 0;
+
+  /* Name of the optional load group. Empty if no group is set */
+  std::string group;
+
+  /* Namespace of the generated ResourceTags enum, which holds the entry */
+  std::string resourceNamespace;
+
+  /* Sound decoding parameters (valid only for sounds) */
+  SoundInfo soundInfo;
+
+  /* Font metrics (valid only for fonts) */
+  FontInfo fontInfo;
+
+  /* Image encoding properties (valid only for images and sprites) */
+  ImageInfo imageInfo;
+
+  /* Trimmed spriteData frames (1:1). Empty if trimming is not performed */
+  std::vector<FrameTrim> frameTrims;
+
+  /* spriteData index -> index of the first pixel identical frame.
+   * Empty if no duplicate frames are found */
+  std::vector<uint32_t> frameRemap;
+
+  /* Scales of the optional 'lods' tag. Empty if the tag is not set */
+  std::vector<double> lodScales;
+};
+
+#endif /* TOOLS_RESOURCE_BUILDER_INCLUDE_BUILDERSTRUCTS_H_ */
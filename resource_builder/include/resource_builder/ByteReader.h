@@ -0,0 +1,129 @@
+#ifndef TOOLS_RESOURCE_BUILDER_INCLUDE_BYTEREADER_H_
+#define TOOLS_RESOURCE_BUILDER_INCLUDE_BYTEREADER_H_
+
+// System headers
+#include <cstddef>
+#include <cstdint>
+#include <span>
+
+// Other libraries headers
+
+// Own components headers
+
+// Forward declarations
+
+/* Readers of the fixed size integers, which are stored in the asset files.
+ *
+ * The values are assembled byte by byte, so the result does not depend on
+ * the host endianness. Compilers fold that into a single load.
+ *
+ * Every read is bounds checked against the provided buffer. A value, which
+ * does not fit in the buffer at the provided offset is read as 0, so a
+ * malformed file can never make the parsers read out of bounds.
+ * */
+class ByteReader {
+ public:
+  ByteReader() = delete;
+
+  /** @brief used to read a big endian value
+   *
+   *  @param std::span<const uint8_t> - input buffer
+   *  @param size_t                   - offset of the value in the buffer
+   *
+   *  @returns uint16_t               - value (0 if out of bounds)
+   * */
+  static uint16_t readBigEndian16(std::span<const uint8_t> data,
+                                  size_t offset = 0) {
+    return static_cast<uint16_t>(read<sizeof(uint16_t), true>(data, offset));
+  }
+
+  /** @brief used to read a big endian two's complement value
+   *
+   *  @param std::span<const uint8_t> - input buffer
+   *  @param size_t                   - offset of the value in the buffer
+   *
+   *  @returns int16_t                - value (0 if out of bounds)
+   * */
+  static int16_t readBigEndianSigned16(std::span<const uint8_t> data,
+                                       size_t offset = 0) {
+    return static_cast<int16_t>(readBigEndian16(data, offset));
+  }
+
+  /** @brief used to read a big endian value
+   *
+   *  @param std::span<const uint8_t> - input buffer
+   *  @param size_t                   - offset of the value in the buffer
+   *
+   *  @returns uint32_t               - value (0 if out of bounds)
+   * */
+  static uint32_t readBigEndian32(std::span<const uint8_t> data,
+                                  size_t offset = 0) {
+    return static_cast<uint32_t>(read<sizeof(uint32_t), true>(data, offset));
+  }
+
+  /** @brief used to read a little endian value
+   *
+   *  @param std::span<const uint8_t> - input buffer
+   *  @param size_t                   - offset of the value in the buffer
+   *
+   *  @returns uint16_t               - value (0 if out of bounds)
+   * */
+  static uint16_t readLittleEndian16(std::span<const uint8_t> data,
+                                     size_t offset = 0) {
+    return static_cast<uint16_t>(read<sizeof(uint16_t), false>(data, offset));
+  }
+
+  /** @brief used to read a 3 bytes little endian value
+   *         (e.g. the ASTC and the WebP VP8X dimensions)
+   *
+   *  @param std::span<const uint8_t> - input buffer
+   *  @param size_t                   - offset of the value in the buffer
+   *
+   *  @returns uint32_t               - value (0 if out of bounds)
+   * */
+  static uint32_t readLittleEndian24(std::span<const uint8_t> data,
+                                     size_t offset = 0) {
+    return static_cast<uint32_t>(read<3, false>(data, offset));
+  }
+
+  /** @brief used to read a little endian value
+   *
+   *  @param std::span<const uint8_t> - input buffer
+   *  @param size_t                   - offset of the value in the buffer
+   *
+   *  @returns uint32_t               - value (0 if out of bounds)
+   * */
+  static uint32_t readLittleEndian32(std::span<const uint8_t> data,
+                                     size_t offset = 0) {
+    return static_cast<uint32_t>(read<sizeof(uint32_t), false>(data, offset));
+  }
+
+  /** @brief used to read a little endian value
+   *
+   *  @param std::span<const uint8_t> - input buffer
+   *  @param size_t                   - offset of the value in the buffer
+   *
+   *  @returns uint64_t               - value (0 if out of bounds)
+   * */
+  static uint64_t readLittleEndian64(std::span<const uint8_t> data,
+                                     size_t offset = 0) {
+    return read<sizeof(uint64_t), false>(data, offset);
+  }
+
+ private:
+  template <size_t SIZE, bool IS_BIG_ENDIAN>
+  static uint64_t read(std::span<const uint8_t> data, const size_t offset) {
+    if ((offset > data.size()) || (SIZE > data.size() - offset)) {
+      return 0;
+    }
+
+    uint64_t value = 0;
+    for (size_t i = 0; i < SIZE; ++i) {
+      const size_t shift = IS_BIG_ENDIAN ? (SIZE - 1 - i) : i;
+      value |= static_cast<uint64_t>(data[offset + i]) << (8 * shift);
+    }
+    return value;
+  }
+};
+
+#endif /* TOOLS_RESOURCE_BUILDER_INCLUDE_BYTEREADER_H_ */
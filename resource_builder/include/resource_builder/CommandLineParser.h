@@ -0,0 +1,40 @@
+#ifndef TOOLS_RESOURCE_BUILDER_INCLUDE_COMMANDLINEPARSER_H_
+#define TOOLS_RESOURCE_BUILDER_INCLUDE_COMMANDLINEPARSER_H_
+
+// System headers
+#include <cstdint>
+
+// Other libraries headers
+#include "utils/ErrorCode.h"
+
+// Own components headers
+#include "resource_builder/ResourceBuilderConfig.h"
+
+// Forward declarations
+
+/* Translates the resource_builder command line into ResourceBuilderConfig.
+ *
+ * Every argument starting with "--" is treated as an option.
+ * All the remaining arguments are treated as project folder names.
+ * */
+class CommandLineParser {
+ public:
+  CommandLineParser() = delete;
+
+  /** @brief used to parse the command line arguments
+   *
+   *  @param const int32_t           - arguments count
+   *  @param const char *[]          - arguments
+   *  @param ResourceBuilderConfig & - populated configuration
+   *
+   *  @returns ErrorCode             - error code
+   * */
+  static ErrorCode parse(const int32_t argc, const char* args[],
+                         ResourceBuilderConfig& outConfig);
+
+  /** @brief used to print the supported command line options
+   * */
+  static void printUsage();
+};
+
+#endif /* TOOLS_RESOURCE_BUILDER_INCLUDE_COMMANDLINEPARSER_H_ */
@@ -0,0 +1,158 @@
+#ifndef TOOLS_RESOURCE_BUILDER_INCLUDE_EMBEDFILEBUILDER_H_
+#define TOOLS_RESOURCE_BUILDER_INCLUDE_EMBEDFILEBUILDER_H_
+
+// System headers
+#include <cstdint>
+#include <string>
+#include <vector>
+
+// Other libraries headers
+#include "utils/ErrorCode.h"
+
+// Own components headers
+#include "resource_builder/AtomicFileStream.h"
+#include "resource_builder/ResourceBuilderConfig.h"
+
+// Forward declarations
+struct BuilderCombinedData;
+
+/* Generates the files, which embed the asset payloads of an individual
+ * .rsrc file directly into the consuming executable:
+ *      > <Name>ResourcesEmbed.h   - index of {hash, pointer, size} entries,
+ *                                   sorted by hash and a lookup function;
+ *      > <Name>ResourcesEmbed.S   - .incbin directives (EmbedMode::INCBIN);
+ *      > <Name>ResourcesEmbed.cpp - byte arrays (EmbedMode::C_ARRAY);
+ *
+ * NOTE: .incbin paths are relative to the root project folder, so the
+ *       root project folder needs to be an include directory of
+ *       the consuming target.
+ * */
+class EmbedFileBuilder {
+ public:
+  EmbedFileBuilder();
+
+  /** @brief used to apply the embed configuration
+   *
+   *  @param const EmbedMode     - selected embed mode
+   *  @param const std::string & - absolute root project folder
+   * */
+  void init(const EmbedMode mode, const std::string& rootDirectory);
+
+  /** @brief used to determine whether embed files should be generated
+   *
+   *  @returns bool - is embedding enabled or not
+   * */
+  bool isEnabled() const { return EmbedMode::NONE != _mode; }
+
+  /** @brief used to set individual games embed file names
+   *
+   *  @param const std::string & - file name (without extension)
+   * */
+  void setDestFileName(const std::string& destFileName);
+
+  /** @brief used to set individual games embed namespace name
+   *
+   *  @param const std::string & - resource namespace value
+   * */
+  void setNamespace(const std::string& inputNamespace);
+
+  /** @brief used to set individual games embed header guards name
+   *
+   *  @param const std::string& - resource header guard value
+   * */
+  void setHeaderGuards(const std::string& guards);
+
+  /** @brief used to open individual games embed files
+   *
+   *  @returns ErrorCode - error code
+   * */
+  ErrorCode openDestStreams();
+
+  /** @brief used to write the embed files for a single .rsrc file
+   *
+   *  @param const std::vector<BuilderCombinedData> & - the parsed data
+   *                                                   from the .rsrc file
+   *
+   *  @returns ErrorCode                             - error code
+   * */
+  ErrorCode writeData(const std::vector<BuilderCombinedData>& data);
+
+  /** @brief used to publish the fully written embed files
+   *
+   *  @param const bool  - whether the files should be flushed to the
+   *                       storage device before being published
+   *
+   *  @returns ErrorCode - error code
+   * */
+  ErrorCode publishDestStreams(const bool syncToDisk);
+
+  /** @brief used to close individual games embed files
+   *         NOTE: unpublished files are discarded
+   * */
+  void closeDestStreams();
+
+ private:
+  /** @brief used to write the index header
+   *
+   *  @param const std::vector<BuilderCombinedData> & - the parsed data
+   *                                                   from the .rsrc file
+   *  @param const std::vector<uint64_t> &           - asset sizes in bytes
+   * */
+  void writeIndexFile(const std::vector<BuilderCombinedData>& data,
+                      const std::vector<uint64_t>& sizes);
+
+  /** @brief used to write the .incbin assembly file
+   *
+   *  @param const std::vector<BuilderCombinedData> & - the parsed data
+   *                                                   from the .rsrc file
+   *
+   *  @returns ErrorCode                             - error code
+   * */
+  ErrorCode writeIncbinFile(const std::vector<BuilderCombinedData>& data);
+
+  /** @brief used to write the byte array source file
+   *
+   *  @param const std::vector<BuilderCombinedData> & - the parsed data
+   *                                                   from the .rsrc file
+   *
+   *  @returns ErrorCode                             - error code
+   * */
+  ErrorCode writeByteArrayFile(const std::vector<BuilderCombinedData>& data);
+
+  /** @brief used to obtain the symbol name for an embedded asset
+   *
+   *  @param const size_t - asset index within the .rsrc file
+   *
+   *  @returns std::string - symbol name
+   * */
+  std::string getSymbolName(const size_t idx) const;
+
+  /** @brief used to obtain the asset path relative to the root project
+   *                                      folder (with '/' separators)
+   *         Assets outside of the root project folder are reached
+   *         with '..' components, so no machine specific absolute path
+   *         ends up in the generated files.
+   *
+   *  @param const std::string & - absolute asset path
+   *  @param std::string &       - relative asset path
+   *
+   *  @returns ErrorCode         - error code (FAILURE if the asset is on
+   *                               a different drive than the root folder)
+   * */
+  ErrorCode getRootRelativePath(const std::string& absolutePath,
+                                std::string& outPath) const;
+
+  AtomicFileStream _indexStream;
+  AtomicFileStream _dataStream;
+
+  std::string _indexFileName;
+  std::string _dataFileName;
+  std::string _indexFileNameNoDir;
+  std::string _namespace;
+  std::string _headerGuards;
+  std::string _rootDirectory;
+
+  EmbedMode _mode;
+};
+
+#endif /* TOOLS_RESOURCE_BUILDER_INCLUDE_EMBEDFILEBUILDER_H_ */
@@ -3,7 +3,7 @@
 
 // System headers
 #include <cstdint>
-#include <fstream>
+#include <map>
 #include <string>
 #include <vector>
 
@@ -11,15 +11,53 @@
 #include "utils/ErrorCode.h"
 
 // Own components header
+#include "resource_builder/AccessTrace.h"
+#include "resource_builder/AssetLinter.h"
+#include "resource_builder/AtomicFileStream.h"
+#include "resource_builder/BuilderStructs.h"
+#include "resource_builder/EmbedFileBuilder.h"
+#include "resource_builder/GlyphAtlasBuilder.h"
+#include "resource_builder/ImageAnalyzer.h"
+#include "resource_builder/IntegrityVerifier.h"
+#include "resource_builder/LodBuilder.h"
+#include "resource_builder/ResourceBuilderConfig.h"
+#include "resource_builder/SoundBankBuilder.h"
+#include "resource_builder/TextureCacheBuilder.h"
 
 // Forward declarations
-struct CombinedData;
 
+/* All the produced files are first written to temporary files and are
+ * published (renamed to their final names) only after they are complete.
+ *
+ * The combined file entries are accumulated from all the .rsrc files and
+ * are written on finishCombinedDestFiles(), ordered by the access trace
+ * (if one is provided).
+ * */
 class FileBuilder {
  public:
+  FileBuilder();
   virtual ~FileBuilder() noexcept;
 
+  /** @brief used to apply the tool configuration
+   *
+   *  @param const ResourceBuilderConfig & - tool configuration
+   *  @param const std::string &           - absolute root project folder
+   *
+   *  @returns ErrorCode                   - error code
+   * */
+  ErrorCode init(const ResourceBuilderConfig& config,
+                 const std::string& rootDirectory);
+
+  /** @brief used to set the header guards of the combined
+   *                                  (project level) ResourceIndices.h
+   *
+   *  @param const std::string& - header guard value
+   * */
+  void setCombinedHeaderGuards(const std::string& guards);
+
   /** @brief used to open combined resource file and font file streams
+   *         NOTE: the ResourceIndices.h and the sound bank (if enabled)
+   *               are placed next to the resource file
    *
    *  @param const std::string & - name of the engine packed resource file
    *  @param const std::string & - name of the engine packed font file
@@ -37,10 +75,23 @@ class FileBuilder {
    * */
   ErrorCode openDestStreams();
 
+  /** @brief used to publish the fully written individual games
+   *                                       resource header and cpp files
+   *
+   *  @returns ErrorCode - error code
+   * */
+  ErrorCode publishDestStreams();
+
   /** @brief used to close individual games resource header and cpp files
+   *         NOTE: unpublished files are discarded
    * */
   void closeDestStream();
 
+  /** @brief used to close combined resource, font and sound files
+   *         NOTE: unpublished files are discarded
+   * */
+  void closeCombinedStreams();
+
   /** @brief used to set individual games namespace name for
    *                                resource header and cpp resource file
    *
@@ -63,103 +114,139 @@ class FileBuilder {
   void setHeaderGuards(const std::string& guards);
 
   /** @brief used write all parsed data from a single .rsrc file to the:
-   *              > engine resource file;
+   *              > engine resource file (deferred until finish);
    *              > individual game resource header and cpp file;
+   *              > individual game embed files (if enabled);
    *
-   *  @param const std::vector<CombinedData> & - the parsed data from the
-   *                                                           .rsrc file
+   *  @param const std::vector<BuilderCombinedData> & - the parsed data
+   *                                                   from the .rsrc file
+   *
+   *  @returns ErrorCode                             - error code
    * */
-  void writeData(const std::vector<CombinedData>& data);
+  ErrorCode writeData(const std::vector<BuilderCombinedData>& data);
 
   /** @brief used write total widgets, fonts and sounds count for:
    *              > engine resource file;
    *              > engine font file;
    *              > engine sound file;
+   *         generate the dense resource indices header
+   *         and publish those files afterwards.
+   *         The load group manifests are also produced at this stage.
    *
    *  @param const uint64_t                   - static widgets count
    *  @param const uint64_t                   - dynamic widgets count
    *  @param const uint64_t                   - fonts count
    *  @param const uint64_t                   - musics count
    *  @param const uint64_t                   - sound chunk count
-   *  @param const int32_t                    - total widgets file size
+   *  @param const uint64_t                   - total widgets file size
+   *                                             in bytes
    *                                             (NOTE: static files only)
-   *  @param const int32_t                    - total fonts file size
-   *  @param const int32_t                    - total sounds file size
-   *  @param const std::vector<std::string> & - all white-listed engine
-   *                                                  common game folders
+   *  @param const uint64_t                   - total fonts file size
+   *                                             in bytes
+   *  @param const uint64_t                   - total sounds file size
+   *                                             in bytes
+   *
+   *  @returns ErrorCode                      - error code
    * */
-  void finishCombinedDestFiles(
+  ErrorCode finishCombinedDestFiles(
       const uint64_t staticWidgetsCount, const uint64_t dynamicWidgetsCount,
       const uint64_t fontsCount, const uint64_t musicsCount,
-      const uint64_t chunksCount, const int32_t totalWidgetFileSize,
-      const int32_t totalFontsFileSize, const int32_t totalSoundsFileSize);
+      const uint64_t chunksCount, const uint64_t totalWidgetFileSize,
+      const uint64_t totalFontsFileSize, const uint64_t totalSoundsFileSize);
 
  private:
-  /** @brief used to close combined resource and font files
+  /** @brief used write all accumulated data to the combined resource,
+   *                                                font and sound files.
+   *
+   *  @param const std::vector<BuilderCombinedData> & - the parsed data
+   *                                                   from all .rsrc files
    * */
-  void closeCombinedStreams();
+  void fillCombinedDestFile(const std::vector<BuilderCombinedData>& data);
 
   /** @brief used write all parsed data from a single .rsrc file to the
-   *                                              combined resource file.
+   *                        individual game resource header and cpp file.
    *
-   *  @param const std::vector<CombinedData> & - the parsed data from the
-   *                                                           .rsrc file
+   *  @param const std::vector<BuilderCombinedData> & - the parsed data
+   *                                                   from the .rsrc file
    * */
-  void fillCombinedDestFile(const std::vector<CombinedData>& data);
+  void autoGenerateResFile(const std::vector<BuilderCombinedData>& data);
 
-  /** @brief used write all parsed data from a single .rsrc file to the
-   *                        individual game resource header and cpp file.
+  /** @brief used to write the dense 0..N-1 resource indices, which follow
+   *         the order of the combined files (widgets, fonts, sounds)
    *
-   *  @param const std::vector<CombinedData> & - the parsed data from the
-   *                                                           .rsrc file
+   *  @param const std::vector<BuilderCombinedData> & - the parsed data
+   *                                                   from all .rsrc files
    * */
-  void autoGenerateResFile(const std::vector<CombinedData>& data);
+  void fillCombinedIndicesFile(const std::vector<BuilderCombinedData>& data);
 
   /** @brief used write total widgets for combined resource file
    *
    *  @param const uint64_t - total static widgets count
    *  @param const uint64_t - total dynamic widgets count
-   *  @param const int32_t  - total widgets file size
+   *  @param const uint64_t - total widgets file size in bytes
    * */
   void finishCombinedResFile(const uint64_t staticWidgetsCount,
                              const uint64_t dynamicWidgetsCount,
-                             const int32_t totalWidgetFileSize);
+                             const uint64_t totalWidgetFileSize);
+
+  /** @brief used to write and publish one manifest file per load group
+   *         Manifests of load groups, which no longer exist are removed.
+   *         NOTE: group members keep the combined files order.
+   *
+   *  @returns ErrorCode - error code
+   * */
+  ErrorCode finishLoadGroupFiles();
+
+  /** @brief used to write a single load group manifest file
+   *
+   *  @param AtomicFileStream &                       - manifest stream
+   *  @param const std::string &                      - load group name
+   *  @param const std::vector<BuilderCombinedData> & - load group entries
+   * */
+  void fillLoadGroupFile(AtomicFileStream& stream, const std::string& group,
+                         const std::vector<BuilderCombinedData>& data);
 
   /** @brief used write total fonts for combined font file
    *
    *  @param const uint64_t - total fonts count
-   *  @param const int32_t  - total fonts file size
+   *  @param const uint64_t - total fonts file size in bytes
    * */
   void finishCombinedFontFile(const uint64_t fontsCount,
-                              const int32_t totalFontsFileSize);
+                              const uint64_t totalFontsFileSize);
 
   /** @brief used write total sound for combined sound file
    *
    *  @param const uint64_t - total musics count
    *  @param const uint64_t - total sound chunk count
-   *  @param const int32_t  - total sounds file size
+   *  @param const uint64_t - total sounds file size in bytes
    * */
   void finishCombinedSoundFile(const uint64_t musicsCount,
                                const uint64_t chunksCount,
-                               const int32_t totalSoundsFileSize);
+                               const uint64_t totalSoundsFileSize);
 
   /* Destination stream for combined only resource file
    * this file contains information for every single resource listed
    * in the individual .rsrc files
    * */
-  std::ofstream _combinedResDestStream;
+  AtomicFileStream _combinedResDestStream;
 
   /* Destination stream for combined only font file
    * this file contains information for every single font listed
    * in the individual .rsrc files
    * */
-  std::ofstream _combinedFontDestStream;
+  AtomicFileStream _combinedFontDestStream;
 
   /* Destination stream for combined only sound file
    * this file contains information for every single sound listed
    * in the individual .rsrc files
    * */
-  std::ofstream _combinedSoundDestStream;
+  AtomicFileStream _combinedSoundDestStream;
+
+  /* Destination stream for the project level ResourceIndices.h
+   * this file contains the dense index for every single resource listed
+   * in the individual .rsrc files
+   * */
+  AtomicFileStream _combinedIndicesDestStream;
 
   /* Destination streams for every individual game resource file
    * that is being auto-generated
@@ -172,9 +259,9 @@ class FileBuilder {
    *       that are not loaded until the game is opened. Then they are
    *       loaded/unloaded on game open/close).
    * */
-  std::ofstream _destStreamStatic;
-  std::ofstream _destStreamDynamic;
-  std::ofstream _destStreamDynamicValues;
+  AtomicFileStream _destStreamStatic;
+  AtomicFileStream _destStreamDynamic;
+  AtomicFileStream _destStreamDynamicValues;
 
   /* Absolute file name for individual game resource header and cpp file
    *                                              (without the extension)
@@ -193,6 +280,68 @@ class FileBuilder {
    * */
   std::string _headerGuardsStatic;
   std::string _headerGuardsDynamic;
+
+  /* Directory, where the combined files are being written */
+  std::string _combinedDestDir;
+
+  /* Header guard value for the project level ResourceIndices.h */
+  std::string _headerGuardsIndices;
+
+  /* Entries for the combined files, accumulated from all the .rsrc
+   * files of the project */
+  std::vector<BuilderCombinedData> _combinedData;
+
+  /* Runtime access trace used to order the produced entries (optional) */
+  AccessTrace _accessTrace;
+
+  /* Used to pack the 'chunk' sounds (if enabled) */
+  SoundBankBuilder _soundBankBuilder;
+
+  /* Used to report the slow to load images (if enabled) */
+  AssetLinter _assetLinter;
+
+  /* Used to validate the checksums of the assets (if enabled) */
+  IntegrityVerifier _integrityVerifier;
+
+  /* Used to run the pixel analyses of the images (if enabled) */
+  ImageAnalyzer _imageAnalyzer;
+
+  /* Used to pre-rasterize the font glyph atlases (if enabled) */
+  GlyphAtlasBuilder _glyphAtlasBuilder;
+
+  /* Used to pre-decode the images into RGBA8 blobs (if enabled) */
+  TextureCacheBuilder _textureCacheBuilder;
+
+  /* Used to generate the downscaled image copies (if requested) */
+  LodBuilder _lodBuilder;
+
+  /* Used to generate the asset embedding files (if enabled) */
+  EmbedFileBuilder _embedFileBuilder;
+
+  /* Whether the produced files should be flushed to the storage device
+   * before being published */
+  bool _syncOutputFiles;
+
+  /* Whether sprites are written as grid descriptors */
+  bool _compactSprites;
+
+  /* Whether and how the normalized frame UVs are written */
+  SpriteUvMode _spriteUvMode;
+
+  /* Whether the 'chunk' sounds are packed into a sound bank */
+  bool _soundBankEnabled;
+
+  /* Whether the fonts are pre-rasterized into glyph atlases */
+  bool _fontAtlasEnabled;
+
+  /* Whether the images are pre-decoded into RGBA8 blobs */
+  bool _textureCacheEnabled;
+
+  /* Whether the slow to load images are reported */
+  bool _lintEnabled;
+
+  /* Whether the asset checksums are validated */
+  bool _integrityCheckEnabled;
 };
 
 #endif /* TOOLS_RESOURCE_BUILDER_INCLUDE_FILEBUILDER_H_ */
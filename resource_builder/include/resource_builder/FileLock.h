@@ -0,0 +1,56 @@
+#ifndef TOOLS_RESOURCE_BUILDER_INCLUDE_FILELOCK_H_
+#define TOOLS_RESOURCE_BUILDER_INCLUDE_FILELOCK_H_
+
+// System headers
+#include <cstdint>
+#include <string>
+
+// Other libraries headers
+#include "utils/ErrorCode.h"
+
+// Own components headers
+
+// Forward declarations
+
+/* Advisory inter-process lock backed by a lock file.
+ *
+ * Used to serialize resource_builder instances that write into the same
+ * output directory. Instances writing into different output directories
+ * (e.g. Debug and Release build trees) never block each other.
+ *
+ * NOTE: the lock file itself is intentionally never removed.
+ *       Removing it would allow two instances to lock different inodes.
+ * */
+class FileLock {
+ public:
+  FileLock() = default;
+  ~FileLock() noexcept;
+
+  FileLock(const FileLock&) = delete;
+  FileLock& operator=(const FileLock&) = delete;
+
+  /** @brief used to acquire the lock. Blocks until the lock is available.
+   *
+   *  @param const std::string & - lock file name
+   *
+   *  @returns ErrorCode         - error code
+   * */
+  ErrorCode lock(const std::string& lockFileName);
+
+  /** @brief used to release the lock (if held)
+   * */
+  void unlock();
+
+ private:
+#if defined(_WIN32) || defined(_WIN64)
+  /* HANDLE of the opened lock file */
+  void* _handle = nullptr;
+#else //linux
+  /* File descriptor of the opened lock file */
+  int32_t _fd = -1;
+#endif
+
+  std::string _lockFileName;
+};
+
+#endif /* TOOLS_RESOURCE_BUILDER_INCLUDE_FILELOCK_H_ */
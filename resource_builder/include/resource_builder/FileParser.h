@@ -13,6 +13,7 @@
 #include "utils/ErrorCode.h"
 
 // Own components headers
+#include "resource_builder/BuilderStructs.h"
 
 // Forward Declaration
 
@@ -107,6 +108,44 @@ class FileParser {
     outHeight = _imageHeight;
   }
 
+  /** @brief used to acquire the decoding parameters from the
+   *                                          currently processed sound.
+   *         NOTE: the parameters are read directly from the sound
+   *               headers (RIFF 'fmt '/'data' chunks for .wav and the
+   *               identification header + last page for .ogg).
+   *
+   *  @param SoundInfo & - sound decoding parameters
+   * */
+   void getSoundInfo(SoundInfo& outInfo) const { outInfo = _soundInfo; }
+
+  /** @brief used to acquire the font metrics from the
+   *                                           currently processed font.
+   *         NOTE: the metrics are read directly from the sfnt
+   *               'head', 'hhea', 'maxp' and 'OS/2' tables.
+   *
+   *  @param FontInfo & - font metrics
+   * */
+   void getFontInfo(FontInfo& outInfo) const { outInfo = _fontInfo; }
+
+  /** @brief used to acquire the encoding properties from the
+   *                                          currently processed image.
+   *         NOTE: the properties are read directly from the PNG 'IHDR'
+   *               chunk, the JPEG start of frame segment or the
+   *               GPU texture container header.
+   *
+   *  @param ImageInfo & - image encoding properties
+   * */
+   void getImageInfo(ImageInfo& outInfo) const { outInfo = _imageInfo; }
+
+  /** @brief used to calculate the digest of the whole file content
+   *         NOTE: the file has to be opened.
+   *
+   *  @param uint64_t & - XXH64 (seed 0) of the file content
+   *
+   *  @returns ErrorCode - error code
+   * */
+   ErrorCode readContentDigest(uint64_t& outDigest);
+
   /** @brief used to open file descriptor
    *
    *  @returns ErrorCode - error code
@@ -124,14 +163,21 @@ class FileParser {
    *          - Graphical:
    *              > .jpg;
    *              > .png;
-   *              > .gif
+   *              > .gif;
+   *              > .webp;
+   *              > .qoi;
+   *              > .ktx2, .dds, .astc (GPU compressed textures);
    *
    *          - Fonts:
    *              > .otf;
+   *              > .ttf;
    *
    *          - Sounds:
    *              > .wav;
    *              > .ogg;
+   *
+   *         NOTE: the file type is detected by it's magic bytes first.
+   *               The extension is used only for unrecognized content.
    * */
   bool isSupportedExtension();
 
@@ -172,18 +218,35 @@ class FileParser {
    * */
    bool isGraphicalFile() const { return _isGraphicalFile; }
 
-  /** @brief used to acquire the file size in kBytes
+  /** @brief used to acquire the exact file size
    *
-   *         NOTE: since we are returning file size in kBytes we choose
-   *               int32_t over int64_t for faster calculations.
-   *
-   *  @return int32_t - file size in kBytes
+   *  @return uint64_t - file size in bytes
    * */
-   int32_t getFileSizeInKiloBytes() const {
-    return static_cast<int32_t>(_fileSize / 1024);
-  }
+  uint64_t getFileSize() const { return static_cast<uint64_t>(_fileSize); }
 
  private:
+  enum class FileType : uint8_t {
+    // Graphical
+    PNG = 0,
+    JPG,
+    GIF,
+    WEBP,
+    QOI,
+    KTX2,
+    DDS,
+    ASTC,
+
+    // Fonts
+    OTF,
+    TTF,
+
+    // Sounds
+    WAV,
+    OGG,
+
+    UNKNOWN = 255
+  };
+
   /** @brief used to build up absolute file path from:
    *                                            > absolute project path;
    *                                            > relative folder path;
@@ -198,12 +261,49 @@ class FileParser {
    * */
   void setFileTypeInternal();
 
+  /** @brief used to map a lower case file extension (of any length)
+   *         to a file type
+   *
+   *  @param const std::string & - file extension without the dot
+   *
+   *  @returns FileType          - file type (UNKNOWN if not supported)
+   * */
+  static FileType getFileTypeFromExtension(const std::string& extension);
+
+  /** @brief used to detect the file type from the magic bytes
+   *         at the beginning of the opened file
+   *
+   *  @returns FileType - file type (UNKNOWN if not recognized)
+   * */
+  FileType getFileTypeFromContent();
+
+  /** @brief used to determine whether the file type is a graphical one
+   *
+   *  @param const FileType - file type
+   *
+   *  @returns bool         - is graphical file type or not
+   * */
+  static bool isGraphicalFileType(const FileType type);
+
+  /** @brief used to determine whether the file type is a font one
+   *
+   *  @param const FileType - file type
+   *
+   *  @returns bool         - is font file type or not
+   * */
+  static bool isFontFileType(const FileType type);
+
   /** @brief used determine whether the provided *.png file is a valid.
    *         This is done by parsing the image header and comparing it
    *         to the standard .PNG header.
    * */
   bool isValidPngFile();
 
+  /** @brief used to walk the PNG chunks between 'IHDR' and the first
+   *         'IDAT' and record the presence of the 'tRNS' and 'gAMA' chunks.
+   * */
+  void readPngAncillaryChunks();
+
   /** @brief used determine whether the provided *.gif file is a valid.
    *         This is done by parsing the image header and comparing it
    *         to the standard .GIF header.
@@ -216,6 +316,51 @@ class FileParser {
    * */
   bool isValidJpgFile();
 
+  /** @brief used determine whether the provided *.webp file is a valid.
+   *         This is done by parsing the RIFF header and the first
+   *         'VP8 ', 'VP8L' or 'VP8X' chunk.
+   * */
+  bool isValidWebpFile();
+
+  /** @brief used determine whether the provided *.qoi file is a valid.
+   *         This is done by parsing the 14 byte QOI header.
+   * */
+  bool isValidQoiFile();
+
+  /** @brief used determine whether the provided *.ktx2 file is a valid.
+   *         This is done by parsing the KTX2 header and the level index.
+   * */
+  bool isValidKtx2File();
+
+  /** @brief used determine whether the provided *.dds file is a valid.
+   *         This is done by parsing the DDS header and the optional
+   *         DX10 header extension.
+   * */
+  bool isValidDdsFile();
+
+  /** @brief used determine whether the provided *.astc file is a valid.
+   *         This is done by parsing the 16 byte ASTC header.
+   * */
+  bool isValidAstcFile();
+
+  /** @brief used determine whether the provided *.wav file is a valid.
+   *         This is done by walking the RIFF chunks and reading
+   *         the 'fmt ' and 'data' (and optional 'fact') chunks.
+   * */
+  bool isValidWavFile();
+
+  /** @brief used determine whether the provided *.ogg file is a valid.
+   *         This is done by parsing the first page Vorbis identification
+   *         header and the granule position of the last page.
+   * */
+  bool isValidOggFile();
+
+  /** @brief used determine whether the provided *.ttf or *.otf file
+   *         is a valid. This is done by parsing the sfnt table directory
+   *         and reading the 'head', 'hhea', 'maxp' and 'OS/2' tables.
+   * */
+  bool isValidFontFile();
+
   /** @brief used to fill sprite description as horizontal layout
    *
    *  @param std::vector<Rectangle>& outData - fully populated sprite
@@ -273,27 +418,19 @@ class FileParser {
   /* Holds the current file size in bytes */
   int64_t _fileSize;
 
-  enum class FileType : uint8_t {
-    // Graphical
-    PNG = 0,
-    JPG,
-    GIF,
-
-    // Fonts
-    OTF,
-    TTF,
+  /* Sound decoding parameters parsed from the sound headers */
+  SoundInfo _soundInfo;
 
-    // Sounds
-    WAV,
-    OGG,
+  /* Font metrics parsed from the font tables */
+  FontInfo _fontInfo;
 
-    UNKNOWN = 255
-  };
+  /* Image encoding properties parsed from the image header */
+  ImageInfo _imageInfo;
 
   FileType _currFileType;
 
   /* Used to determine whether the processed file is graphical one -
-   * e.g. with extensions .jpg, .png, .gif or not
+   * e.g. with extensions .jpg, .png, .gif, .ktx2, .dds, .astc or not
    * */
   bool _isGraphicalFile;
 };
@@ -0,0 +1,104 @@
+#ifndef TOOLS_RESOURCE_BUILDER_INCLUDE_GLYPHATLASBUILDER_H_
+#define TOOLS_RESOURCE_BUILDER_INCLUDE_GLYPHATLASBUILDER_H_
+
+// System headers
+#include <cstdint>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+// Other libraries headers
+#include "utils/ErrorCode.h"
+
+// Own components headers
+#include "resource_builder/ResourceBuilderConfig.h"
+
+// Forward declarations
+struct BuilderCombinedData;
+class TrueTypeFont;
+
+/* Pre-rasterizes the configured character set of every font entry at
+ * it's declared size, so the runtime uploads a single texture per font
+ * instead of rasterizing the glyphs on startup.
+ *
+ * For every font two files are produced inside the font_atlases folder
+ * (next to the combined font file):
+ *      > <HASH>.png - RGBA atlas (white glyphs, coverage in alpha);
+ *      > <HASH>.bin - glyph metrics table:
+ *
+ *          #glyphs: <count>
+ *          #atlas: <width> <height>
+ *          #line height: <pixels>
+ *          <codepoint> <advance> <bearingX> <bearingY> <width> <height>
+ *                                      <x> <y> <u0> <v0> <u1> <v1>
+ *          ...
+ *
+ * Fonts, which can not be rasterized (e.g. CFF outlines) are skipped
+ * with a warning and remain rasterized at runtime.
+ * */
+class GlyphAtlasBuilder {
+ public:
+  /** @brief used to set the rasterized character set
+   *
+   *  @param const std::vector<CodepointRange> & - unicode codepoint ranges
+   * */
+  void init(const std::vector<CodepointRange>& charset);
+
+  /** @brief used to build and publish the atlases of all font entries
+   *
+   *  @param const std::string &                     - combined files folder
+   *  @param const std::vector<BuilderCombinedData> & - the parsed data
+   *                                                   from all .rsrc files
+   *  @param const bool                              - whether the files
+   *                          should be flushed to the storage device
+   *
+   *  @returns ErrorCode                             - error code
+   * */
+  ErrorCode writeData(const std::string& destDir,
+                      const std::vector<BuilderCombinedData>& data,
+                      const bool syncToDisk);
+
+  /** @brief used to obtain the atlas name of a font
+   *
+   *  @param const uint64_t - font hash value
+   *  @param std::string &  - atlas file name, relative to the combined
+   *                          files folder and without extension
+   *
+   *  @returns bool         - does the font have an atlas or not
+   * */
+  bool getAtlasName(const uint64_t hashValue, std::string& outName) const;
+
+  /** @brief used to remove the atlases of fonts, which are no longer
+   *                                         described in the project
+   *
+   *  @param const std::string & - combined files folder
+   * */
+  void removeStaleAtlases(const std::string& destDir) const;
+
+  /** @brief used to forget the atlases of the last build
+   * */
+  void reset();
+
+ private:
+  /** @brief used to rasterize, pack and publish a single font atlas
+   *
+   *  @param const BuilderCombinedData & - font entry
+   *  @param const TrueTypeFont &        - loaded font file
+   *  @param const std::string &         - atlas file name (no extension)
+   *  @param const bool                  - sync to disk
+   *
+   *  @returns ErrorCode                 - error code
+   * */
+  ErrorCode buildAtlas(const BuilderCombinedData& entry,
+                       const TrueTypeFont& font,
+                       const std::string& fileName,
+                       const bool syncToDisk) const;
+
+  /* Rasterized unicode codepoint ranges */
+  std::vector<CodepointRange> _charset;
+
+  /* font hash value -> atlas name (relative, without extension) */
+  std::unordered_map<uint64_t, std::string> _atlasNames;
+};
+
+#endif /* TOOLS_RESOURCE_BUILDER_INCLUDE_GLYPHATLASBUILDER_H_ */
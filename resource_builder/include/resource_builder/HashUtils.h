@@ -0,0 +1,106 @@
+#ifndef TOOLS_RESOURCE_BUILDER_INCLUDE_HASHUTILS_H_
+#define TOOLS_RESOURCE_BUILDER_INCLUDE_HASHUTILS_H_
+
+// System headers
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+// Other libraries headers
+
+// Own components headers
+
+// Forward declarations
+
+/* Hash functions, which produce identical values on every platform,
+ * compiler and standard library implementation.
+ *
+ * NOTE: std::hash is implementation defined and therefore must not be
+ *       used for any value, which ends up in the produced files.
+ * */
+class HashUtils {
+ public:
+  HashUtils() = delete;
+
+  /** @brief used to calculate the resource hash value from it's path.
+   *         Path separators are normalized to '/' before hashing,
+   *         so the value is the same on every platform.
+   *
+   *  @param const std::string & - resource path
+   *
+   *  @returns uint64_t          - FNV-1a 64 bit hash value
+   * */
+  static uint64_t hashResourcePath(const std::string& path);
+
+  /** @brief used to calculate the hash value of a data block.
+   *         Data is consumed in 32 byte stripes by 4 independent
+   *         accumulators, which keeps the CPU pipelines saturated.
+   *
+   *  @param const uint8_t * - input data
+   *  @param size_t          - input data size
+   *  @param uint64_t        - seed value
+   *
+   *  @returns uint64_t      - XXH64 hash value
+   * */
+  static uint64_t hashData(const uint8_t* data, size_t size,
+                           uint64_t seed = 0);
+
+  /** @brief used to calculate the hash value of a large data block.
+   *         Data is consumed in 64 byte stripes by 8 lanes, which
+   *         accumulate 32x32 bit products (the XXH3 long input scheme).
+   *         On x86 CPUs with AVX2 a stripe is processed by 2 vector
+   *         registers. Other CPUs use the scalar lanes. The CPU features
+   *         are detected at runtime and both variants produce the same
+   *         value.
+   *
+   *         NOTE: the value differs from hashData() for the same input.
+   *
+   *  @param const uint8_t * - input data
+   *  @param size_t          - input data size
+   *  @param uint64_t        - seed value
+   *
+   *  @returns uint64_t      - hash value
+   * */
+  static uint64_t hashDataWide(const uint8_t* data, size_t size,
+                               uint64_t seed = 0);
+
+  /** @brief used to derive a key from an already calculated hash value
+   *         (e.g. a content digest) without hashing the data again
+   *
+   *  @param uint64_t   - hash value
+   *  @param uint64_t   - seed value
+   *
+   *  @returns uint64_t - XXH64 hash value of the little endian bytes
+   *                      of the provided hash value
+   * */
+  static uint64_t hashDigest(uint64_t digest, uint64_t seed);
+
+  /** @brief used to calculate/continue CRC-32 (ISO-HDLC, as used by
+   *                                                   PNG, zlib, gzip)
+   *         On x86 CPUs with carry-less multiplication (PCLMULQDQ) the
+   *         data is folded 64 bytes per iteration. Other CPUs use
+   *         the lookup table. The CPU features are detected at runtime.
+   *
+   *  @param const uint8_t * - input data
+   *  @param size_t          - input data size
+   *  @param uint32_t        - CRC of the preceding data (0 on start)
+   *
+   *  @returns uint32_t      - CRC value
+   * */
+  static uint32_t crc32(const uint8_t* data, size_t size, uint32_t crc = 0);
+
+  /** @brief used to calculate/continue the Ogg page CRC-32
+   *         (non reflected polynomial 0x04C11DB7, zero initial value
+   *         and no final xor)
+   *
+   *  @param const uint8_t * - input data
+   *  @param size_t          - input data size
+   *  @param uint32_t        - CRC of the preceding data (0 on start)
+   *
+   *  @returns uint32_t      - CRC value
+   * */
+  static uint32_t crc32Ogg(const uint8_t* data, size_t size,
+                           uint32_t crc = 0);
+};
+
+#endif /* TOOLS_RESOURCE_BUILDER_INCLUDE_HASHUTILS_H_ */
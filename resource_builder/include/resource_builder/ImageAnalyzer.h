@@ -0,0 +1,89 @@
+#ifndef TOOLS_RESOURCE_BUILDER_INCLUDE_IMAGEANALYZER_H_
+#define TOOLS_RESOURCE_BUILDER_INCLUDE_IMAGEANALYZER_H_
+
+// System headers
+#include <cstdint>
+#include <vector>
+
+// Other libraries headers
+#include "utils/ErrorCode.h"
+
+// Own components headers
+
+// Forward declarations
+struct BuilderCombinedData;
+struct ResourceBuilderConfig;
+struct RgbaImage;
+
+/* Decodes the images of the project and runs the enabled pixel
+ * analyses on their frames:
+ *      > transparent margins trimming - the tight alpha bounds of every
+ *        frame together with it's offset inside the original frame;
+ *      > duplicate frames detection - a frame index remap table, where
+ *        pixel identical frames share the index of their first occurrence;
+ *
+ * NOTE: only PNG images are decoded. The other formats are skipped with
+ *       a warning and are written without analysis results.
+ * */
+class ImageAnalyzer {
+ public:
+  ImageAnalyzer();
+
+  /** @brief used to apply the tool configuration
+   *
+   *  @param const ResourceBuilderConfig & - tool configuration
+   * */
+  void init(const ResourceBuilderConfig& config);
+
+  /** @brief used to determine whether any analysis is enabled
+   *
+   *  @returns bool - is analysis enabled or not
+   * */
+  bool isEnabled() const { return _trimFrames || _dedupeFrames; }
+
+  /** @brief used to analyze all image entries
+   *
+   *  @param std::vector<BuilderCombinedData> & - the parsed data from all
+   *                      .rsrc files. Populated with the analysis results
+   *
+   *  @returns ErrorCode                       - error code
+   * */
+  ErrorCode analyze(std::vector<BuilderCombinedData>& data) const;
+
+ private:
+  /** @brief used to decode the image of an entry
+   *
+   *  @param const BuilderCombinedData & - image entry
+   *  @param RgbaImage &                 - decoded image
+   *  @param bool &                      - is the image format supported
+   *
+   *  @returns ErrorCode                 - error code
+   * */
+  static ErrorCode decodeImage(const BuilderCombinedData& entry,
+                               RgbaImage& outImage, bool& outIsSupported);
+
+  /** @brief used to compute the tight alpha bounds of every frame
+   *
+   *  @param const RgbaImage &     - decoded image
+   *  @param BuilderCombinedData & - image entry
+   * */
+  static void trimFrames(const RgbaImage& image, BuilderCombinedData& entry);
+
+  /** @brief used to find the pixel identical frames
+   *
+   *  @param const RgbaImage &     - decoded image
+   *  @param BuilderCombinedData & - image entry
+   *
+   *  @returns uint64_t            - pixels area of the duplicate frames
+   * */
+  static uint64_t dedupeFrames(const RgbaImage& image,
+                               BuilderCombinedData& entry);
+
+  /* Whether the fully transparent frame margins are trimmed */
+  bool _trimFrames;
+
+  /* Whether the pixel identical frames are collapsed */
+  bool _dedupeFrames;
+};
+
+#endif /* TOOLS_RESOURCE_BUILDER_INCLUDE_IMAGEANALYZER_H_ */
@@ -0,0 +1,87 @@
+#ifndef TOOLS_RESOURCE_BUILDER_INCLUDE_INTEGRITYVERIFIER_H_
+#define TOOLS_RESOURCE_BUILDER_INCLUDE_INTEGRITYVERIFIER_H_
+
+// System headers
+#include <cstdint>
+#include <string>
+#include <vector>
+
+// Other libraries headers
+#include "utils/ErrorCode.h"
+
+// Own components headers
+
+// Forward declarations
+struct BuilderCombinedData;
+
+/* Reads every referenced asset completely and validates it's checksums
+ * and structure, so corrupted files fail the build instead of
+ * the runtime decoding:
+ *      > PNG - every chunk length and CRC-32, up to the 'IEND' chunk;
+ *      > JPEG - the end of image (EOI) marker;
+ *      > Ogg - every page capture pattern, length and CRC-32;
+ *
+ * The other formats are read, but not validated.
+ * The assets are verified in parallel by all hardware threads.
+ * */
+class IntegrityVerifier {
+ public:
+  IntegrityVerifier() = default;
+
+  /** @brief used to verify the assets of all entries and log every
+   *         corrupted asset
+   *
+   *  @param const std::vector<BuilderCombinedData> & - the parsed data
+   *                                                   from all .rsrc files
+   *
+   *  @returns ErrorCode - error code (FAILURE if any asset is corrupted)
+   * */
+  ErrorCode verify(const std::vector<BuilderCombinedData>& data) const;
+
+ private:
+  /* Verification result of a single asset */
+  struct AssetResult {
+    /* Empty for a valid asset */
+    std::string error;
+
+    uint64_t fileSize = 0;
+    bool isChecked = false;
+  };
+
+  /** @brief used to read and verify a single asset
+   *
+   *  @param const std::string & - absolute file path
+   *  @param AssetResult &       - verification result
+   * */
+  static void verifyAsset(const std::string& filePath,
+                          AssetResult& outResult);
+
+  /** @brief used to validate the PNG chunks
+   *
+   *  @param const std::vector<uint8_t> & - file content
+   *
+   *  @returns std::string                - error description (empty if
+   *                                        the file is valid)
+   * */
+  static std::string verifyPng(const std::vector<uint8_t>& fileData);
+
+  /** @brief used to validate the JPEG end of image marker
+   *
+   *  @param const std::vector<uint8_t> & - file content
+   *
+   *  @returns std::string                - error description (empty if
+   *                                        the file is valid)
+   * */
+  static std::string verifyJpg(const std::vector<uint8_t>& fileData);
+
+  /** @brief used to validate the Ogg pages
+   *
+   *  @param const std::vector<uint8_t> & - file content
+   *
+   *  @returns std::string                - error description (empty if
+   *                                        the file is valid)
+   * */
+  static std::string verifyOgg(const std::vector<uint8_t>& fileData);
+};
+
+#endif /* TOOLS_RESOURCE_BUILDER_INCLUDE_INTEGRITYVERIFIER_H_ */
@@ -0,0 +1,129 @@
+#ifndef TOOLS_RESOURCE_BUILDER_INCLUDE_LODBUILDER_H_
+#define TOOLS_RESOURCE_BUILDER_INCLUDE_LODBUILDER_H_
+
+// System headers
+#include <cstdint>
+#include <string>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+
+// Other libraries headers
+#include "resource_utils/structs/CombinedStructs.h"
+#include "utils/ErrorCode.h"
+
+// Own components headers
+
+// Forward declarations
+struct BuilderCombinedData;
+struct RgbaImage;
+
+/* Downscaled copy of an image entry */
+struct TextureLod {
+  /* Scale factor in the (0, 1) range, relative to the source image */
+  double scale = 0.0;
+
+  /* PNG file name, relative to the combined files folder */
+  std::string fileName;
+
+  /* Scaled imageRect and spriteData of the entry */
+  Rectangle imageRect;
+  std::vector<Rectangle> spriteData;
+};
+
+/* Generates downscaled (level of detail) copies of the images, so the
+ * runtime can load only the resolution the device actually needs.
+ *
+ * The scales are taken from the optional 'lods' tag of an entry or from
+ * the global '--lods' option. Scale 1 stands for the source image itself
+ * and produces no additional file.
+ *
+ * The images are resampled with an area (box) filter - every destination
+ * pixel is the coverage weighted average of the source pixels beneath it.
+ * Color channels are averaged alpha weighted, so transparent pixels
+ * do not darken the edges.
+ *
+ * The LOD files are written inside the lods folder (next to the combined
+ * resource file) and are named after the content digest of the source
+ * file and the scale - unchanged images are neither read nor resampled
+ * again.
+ *
+ * NOTE: only PNG images are decoded. The other formats are skipped with
+ *       a warning and are available only in their source resolution.
+ * */
+class LodBuilder {
+ public:
+  LodBuilder() = default;
+
+  /** @brief used to set the scales of the entries without a 'lods' tag
+   *
+   *  @param const std::vector<double> & - default scales
+   * */
+  void init(const std::vector<double>& defaultScales);
+
+  /** @brief used to produce the LOD files of all image entries
+   *
+   *  @param const std::string &                     - combined files folder
+   *  @param const std::vector<BuilderCombinedData> & - the parsed data
+   *                                                   from all .rsrc files
+   *  @param const bool                              - whether the files
+   *                          should be flushed to the storage device
+   *
+   *  @returns ErrorCode                             - error code
+   * */
+  ErrorCode writeData(const std::string& destDir,
+                      const std::vector<BuilderCombinedData>& data,
+                      const bool syncToDisk);
+
+  /** @brief used to obtain the LODs of an image entry
+   *
+   *  @param const uint64_t - resource hash value
+   *
+   *  @returns const std::vector<TextureLod> * - LODs of the entry or
+   *                                             nullptr if it has none
+   * */
+  const std::vector<TextureLod>* getLods(const uint64_t hashValue) const;
+
+  /** @brief used to remove the LOD files, which are no longer referenced
+   *
+   *  @param const std::string & - combined files folder
+   * */
+  void removeStaleLods(const std::string& destDir) const;
+
+  /** @brief used to forget the LODs of the last build
+   * */
+  void reset();
+
+  /** @brief used to parse a comma separated list of scales (e.g. 1,0.5)
+   *         Every scale must be in the (0, 1] range and appear only once.
+   *
+   *  @param const std::string &   - scales text
+   *  @param std::vector<double> & - parsed scales, in descending order
+   *
+   *  @returns bool                - is the list valid or not
+   * */
+  static bool parseScales(const std::string& text,
+                          std::vector<double>& outScales);
+
+ private:
+  /** @brief used to resample an image with an area (box) filter
+   *
+   *  @param const RgbaImage & - source image
+   *  @param const int32_t     - destination width
+   *  @param const int32_t     - destination height
+   *  @param RgbaImage &       - destination image
+   * */
+  static void downscale(const RgbaImage& image, const int32_t width,
+                        const int32_t height, RgbaImage& outImage);
+
+  /* scales of the entries without a 'lods' tag */
+  std::vector<double> _defaultScales;
+
+  /* resource hash value -> LODs of the entry */
+  std::unordered_map<uint64_t, std::vector<TextureLod>> _lods;
+
+  /* LOD file names, which are referenced by the last build */
+  std::unordered_set<std::string> _usedFileNames;
+};
+
+#endif /* TOOLS_RESOURCE_BUILDER_INCLUDE_LODBUILDER_H_ */
@@ -0,0 +1,60 @@
+#ifndef TOOLS_RESOURCE_BUILDER_INCLUDE_OGGPAGE_H_
+#define TOOLS_RESOURCE_BUILDER_INCLUDE_OGGPAGE_H_
+
+// System headers
+#include <cstddef>
+#include <cstdint>
+#include <span>
+
+// Other libraries headers
+
+// Own components headers
+
+// Forward declarations
+
+enum class OggPageStatus : uint8_t {
+  VALID,
+  INVALID_HEADER,  // missing capture pattern or truncated page header
+  TRUNCATED_SEGMENT_TABLE,
+  TRUNCATED_PAGE,
+  CRC_MISMATCH
+};
+
+/* Parsed Ogg page header fields */
+struct OggPageInfo {
+  static constexpr uint8_t EOS_FLAG = 0x04;
+  static constexpr uint64_t UNKNOWN_GRANULE = UINT64_MAX;
+
+  uint64_t granule = 0;
+  uint32_t serial = 0;
+  uint32_t storedCrc = 0;
+  uint32_t computedCrc = 0;
+  size_t size = 0;  // header, segment table and body
+  uint8_t headerType = 0;
+};
+
+/* Ogg page parser, shared by the sound parameters extraction and
+ * the integrity verification, so both accept exactly the same pages.
+ * */
+class OggPage {
+ public:
+  OggPage() = delete;
+
+  static constexpr size_t HEADER_SIZE = 27;
+
+  /** @brief used to parse and validate the Ogg page, which starts at the
+   *         beginning of the provided data. The data may extend past
+   *         the end of the page.
+   *
+   *  @param std::span<const uint8_t> - page data
+   *  @param OggPageInfo &            - parsed page header fields.
+   *                                    CRCs are populated only if the
+   *                                    whole page is available
+   *
+   *  @returns OggPageStatus          - validation status
+   * */
+  static OggPageStatus read(std::span<const uint8_t> data,
+                            OggPageInfo& outInfo);
+};
+
+#endif /* TOOLS_RESOURCE_BUILDER_INCLUDE_OGGPAGE_H_ */
@@ -0,0 +1,67 @@
+#ifndef TOOLS_RESOURCE_BUILDER_INCLUDE_PNGCODEC_H_
+#define TOOLS_RESOURCE_BUILDER_INCLUDE_PNGCODEC_H_
+
+// System headers
+#include <cstdint>
+#include <vector>
+
+// Other libraries headers
+#include "utils/ErrorCode.h"
+
+// Own components headers
+
+// Forward declarations
+
+/* 8 bit per channel RGBA image with rows stored top to bottom */
+struct RgbaImage {
+  static constexpr uint32_t CHANNELS = 4;
+
+  uint32_t width = 0;
+  uint32_t height = 0;
+  std::vector<uint8_t> pixels;
+};
+
+/* Self-contained PNG codec, used for the images produced by the tool.
+ *
+ * The encoder always produces 8 bit RGBA, non-interlaced images.
+ * Rows are filtered with the minimum sum of absolute differences
+ * heuristic and compressed with LZ77 + fixed Huffman codes deflate.
+ *
+ * The decoder supports every standard PNG - all color types and bit
+ * depths, 'tRNS' transparency and Adam7 interlacing. The result is always
+ * converted to 8 bit RGBA (16 bit samples are truncated).
+ * */
+class PngCodec {
+ public:
+  PngCodec() = delete;
+
+  /** @brief used to encode an image into a PNG file content
+   *
+   *  @param const RgbaImage &      - source image
+   *  @param std::vector<uint8_t> & - PNG file content
+   *
+   *  @returns ErrorCode            - error code
+   * */
+  static ErrorCode encode(const RgbaImage& image,
+                          std::vector<uint8_t>& outData);
+
+  /** @brief used to decode a PNG file content into an RGBA image
+   *
+   *  @param const std::vector<uint8_t> & - PNG file content
+   *  @param RgbaImage &                  - decoded image
+   *
+   *  @returns ErrorCode                  - error code
+   * */
+  static ErrorCode decode(const std::vector<uint8_t>& data,
+                          RgbaImage& outImage);
+
+  /** @brief used to check whether data starts with the PNG signature
+   *
+   *  @param const std::vector<uint8_t> & - file content
+   *
+   *  @returns bool                       - is PNG or not
+   * */
+  static bool hasSignature(const std::vector<uint8_t>& data);
+};
+
+#endif /* TOOLS_RESOURCE_BUILDER_INCLUDE_PNGCODEC_H_ */
@@ -0,0 +1,56 @@
+#ifndef TOOLS_RESOURCE_BUILDER_INCLUDE_REPRODUCIBILITYVERIFIER_H_
+#define TOOLS_RESOURCE_BUILDER_INCLUDE_REPRODUCIBILITYVERIFIER_H_
+
+// System headers
+#include <string>
+
+// Other libraries headers
+#include "utils/ErrorCode.h"
+
+// Own components headers
+
+// Forward declarations
+struct ResourceBuilderConfig;
+
+/* Self-check, which guarantees that identical inputs produce
+ * byte-identical outputs.
+ *
+ * The requested projects are built twice into two separate temporary
+ * output directories and the produced file trees are compared byte by
+ * byte. The temporary directories are removed afterwards.
+ * */
+class ReproducibilityVerifier {
+ public:
+  ReproducibilityVerifier() = delete;
+
+  /** @brief used to build the projects twice and compare the outputs
+   *
+   *  @param const ResourceBuilderConfig & - tool configuration
+   *
+   *  @returns ErrorCode                   - error code
+   * */
+  static ErrorCode verify(const ResourceBuilderConfig& config);
+
+ private:
+  /** @brief used to build all the configured projects into a directory
+   *
+   *  @param const ResourceBuilderConfig & - tool configuration
+   *  @param const std::string &           - output directory
+   *
+   *  @returns ErrorCode                   - error code
+   * */
+  static ErrorCode buildInto(const ResourceBuilderConfig& config,
+                             const std::string& outputDir);
+
+  /** @brief used to compare two produced output trees
+   *
+   *  @param const std::string & - first output directory
+   *  @param const std::string & - second output directory
+   *
+   *  @returns ErrorCode         - error code (failure on any difference)
+   * */
+  static ErrorCode compareTrees(const std::string& firstDir,
+                                const std::string& secondDir);
+};
+
+#endif /* TOOLS_RESOURCE_BUILDER_INCLUDE_REPRODUCIBILITYVERIFIER_H_ */
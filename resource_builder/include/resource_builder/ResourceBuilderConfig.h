@@ -0,0 +1,150 @@
+#ifndef TOOLS_RESOURCE_BUILDER_INCLUDE_RESOURCEBUILDERCONFIG_H_
+#define TOOLS_RESOURCE_BUILDER_INCLUDE_RESOURCEBUILDERCONFIG_H_
+
+// System headers
+#include <cstdint>
+#include <string>
+#include <vector>
+
+// Other libraries headers
+
+// Own components headers
+
+// Forward declarations
+
+/* Selects whether and how the asset payloads are embedded
+ * into the consuming executable */
+enum class EmbedMode : uint8_t {
+  NONE,
+
+  /* assembly file (.S) referencing the assets through .incbin directives
+   * Supported by GCC and Clang toolchains */
+  INCBIN,
+
+  /* C++ source file holding the assets as byte arrays
+   * Supported by every toolchain (MSVC, Emscripten included) */
+  C_ARRAY
+};
+
+/* Selects whether the normalized UV quad of every sprite frame
+ * is written next to the integer frame rectangles */
+enum class SpriteUvMode : uint8_t {
+  NONE,
+
+  /* UVs cover the whole frame rectangle */
+  EXACT,
+
+  /* UVs are moved half a texel inwards on every side, so bilinear
+   * filtering does not sample the neighbouring frames */
+  HALF_TEXEL_INSET
+};
+
+/* Selects whether the images are pre-decoded into raw RGBA8 blobs */
+enum class TextureCacheMode : uint8_t {
+  NONE,
+
+  /* color channels are stored as they are */
+  STRAIGHT_ALPHA,
+
+  /* color channels are multiplied by the alpha channel */
+  PREMULTIPLIED_ALPHA
+};
+
+/* Selects what happens, when a texture memory budget is exceeded */
+enum class BudgetAction : uint8_t {
+  /* the build is reported as failed */
+  FAIL,
+
+  /* a warning is logged and the build continues */
+  WARN
+};
+
+/* Decoded (RGBA8) texture memory budgets in bytes. 0 - no budget */
+struct TextureBudgets {
+  /* budget of a single image entry */
+  uint64_t entry = 0;
+
+  /* budget of all image entries in a single .rsrc file */
+  uint64_t resourceFile = 0;
+
+  /* budgets of all on_init and all on_demand image entries of a project */
+  uint64_t onInit = 0;
+  uint64_t onDemand = 0;
+
+  BudgetAction action = BudgetAction::FAIL;
+};
+
+/* Inclusive range of unicode codepoints */
+struct CodepointRange {
+  uint32_t first = 0;
+  uint32_t last = 0;
+};
+
+/* Holds the command line configuration of the resource_builder tool */
+struct ResourceBuilderConfig {
+  /* List of project folder names within the root project folder to parse */
+  std::vector<std::string> projectNames;
+
+  /* Directory, where the auto-generated files are written.
+   * The project folder hierarchy is mirrored inside it.
+   * When empty - the files are written inside the project source tree */
+  std::string outputDir;
+
+  /* Whether every produced output file should be flushed to the storage
+   * device (fsync) before it is published with rename.
+   * Off by default, since it noticeably slows down big resource trees */
+  bool syncOutputFiles = false;
+
+  /* Whether asset embedding files are generated next to
+   * the individual resource headers */
+  EmbedMode embedMode = EmbedMode::NONE;
+
+  /* Runtime access trace file (hash values in first-use order), used to
+   * order the produced entries. When empty - discovery order is kept */
+  std::string accessTraceFile;
+
+  /* Whether the projects are built twice into temporary directories and
+   * the outputs are compared byte by byte, before the actual build */
+  bool verifyReproducible = false;
+
+  /* Whether 'type=sprite' entries are written as constant size grid
+   * descriptors instead of expanded frame lists */
+  bool compactSprites = false;
+
+  /* Whether normalized frame UVs are written to the combined file */
+  SpriteUvMode spriteUvMode = SpriteUvMode::NONE;
+
+  /* Whether the 'chunk' sounds are packed into a single sound bank file */
+  bool soundBank = false;
+
+  /* Whether the font entries are pre-rasterized into glyph atlases */
+  bool fontAtlas = false;
+
+  /* Unicode codepoints, which are rasterized into the glyph atlases */
+  std::vector<CodepointRange> fontAtlasCharset;
+
+  /* Whether and how the images are pre-decoded into RGBA8 blobs */
+  TextureCacheMode textureCacheMode = TextureCacheMode::NONE;
+
+  /* Whether the fully transparent margins of every frame are trimmed */
+  bool trimFrames = false;
+
+  /* Whether pixel identical frames of an entry are collapsed */
+  bool dedupeFrames = false;
+
+  /* Downscaled copies (scales in the (0, 1] range), which are generated
+   * for the image entries without a 'lods' tag. Empty - no copies */
+  std::vector<double> lodScales;
+
+  /* Decoded texture memory budgets, checked for every project */
+  TextureBudgets textureBudgets;
+
+  /* Whether a ranked report of the slow to load images is logged */
+  bool lint = false;
+
+  /* Whether the PNG chunk, JPEG EOI and Ogg page checksums of every
+   * asset are validated */
+  bool verifyIntegrity = false;
+};
+
+#endif /* TOOLS_RESOURCE_BUILDER_INCLUDE_RESOURCEBUILDERCONFIG_H_ */
@@ -8,13 +8,16 @@
 #include <unordered_set>
 
 // Other libraries headers
-#include "resource_utils/structs/CombinedStructs.h"
 #include "utils/ErrorCode.h"
 
 // Own components headers
+#include "resource_builder/BuilderStructs.h"
 #include "resource_builder/FileBuilder.h"
+#include "resource_builder/FileLock.h"
 #include "resource_builder/FileParser.h"
+#include "resource_builder/ResourceBuilderConfig.h"
 #include "resource_builder/SyntaxChecker.h"
+#include "resource_builder/TextureBudget.h"
 
 // Forward Declarations
 
@@ -27,9 +30,11 @@ public:
    *              > setting engine resource file and font font names;
    *              > open streams for those files;
    *
-   *  @returns ErrorCode - error code
+   *  @param const ResourceBuilderConfig & - tool configuration
+   *
+   *  @returns ErrorCode                   - error code
    * */
-  ErrorCode init();
+  ErrorCode init(const ResourceBuilderConfig &config);
 
   /** @brief used to parse project tree directory recursively, search
    *                                      for .rsrc files and parse them.
@@ -93,57 +98,89 @@ private:
   /** @bried used fill individual field of data
    *                       from a parsed string line from the .rsrc file.
    *
-   *  @param const std::string & - parsed row data
-   *  @param const int32_t       - event code
+   *  @param const std::string &   - parsed row data
+   *  @param const int32_t         - event code
    *              (in order to know how to manipulate the parsed row data)
-   *  @param CombinedData &      - populated structure
+   *  @param BuilderCombinedData & - populated structure
    *
-   *  @returns ErrorCode         - error code
+   *  @returns ErrorCode           - error code
    * */
   ErrorCode setSingleRowData(const std::string &rowData,
-                             const int32_t eventCode, CombinedData &outData);
+                             const int32_t eventCode,
+                             BuilderCombinedData &outData);
 
   /** @bried used fill CombinedData description when
    *                                             "path" tag is processed.
    *
-   *  @param const std::string & - relative file path
-   *  @param CombinedData &      - populated structure
+   *  @param const std::string &   - relative file path
+   *  @param BuilderCombinedData & - populated structure
    *
-   *  @returns ErrorCode         - error code
+   *  @returns ErrorCode           - error code
    * */
   ErrorCode fillPath(const std::string &relativeFilePath,
-                     CombinedData &outData);
+                     BuilderCombinedData &outData);
 
   /** @bried used fill CombinedData description when
    *                                      "description" tag is processed.
    *
-   *  @param const std::string & - parsed row data
-   *  @param CombinedData &      - populated structure
+   *  @param const std::string &   - parsed row data
+   *  @param BuilderCombinedData & - populated structure
    *
-   *  @returns ErrorCode         - error code
+   *  @returns ErrorCode           - error code
    * */
-  ErrorCode fillDescription(const std::string &rowData, CombinedData &outData);
+  ErrorCode fillDescription(const std::string &rowData,
+                            BuilderCombinedData &outData);
 
   /** @brief used fill CombinedData description when
    *                                         "position" tag is processed.
    *
-   *  @param const std::string & - parsed row data
-   *  @param CombinedData &      - populated structure
+   *  @param const std::string &   - parsed row data
+   *  @param BuilderCombinedData & - populated structure
    *
-   *  @returns ErrorCode         - error code
+   *  @returns ErrorCode           - error code
    * */
-  ErrorCode setImagePosition(const std::string &rowData, CombinedData &outData);
+  ErrorCode setImagePosition(const std::string &rowData,
+                             BuilderCombinedData &outData);
 
   /** @brief used fill CombinedData description when
    *                                         "load" tag is processed.
    *
-   *  @param const std::string & - parsed row data
-   *  @param CombinedData &      - populated structure
+   *  @param const std::string &   - parsed row data
+   *  @param BuilderCombinedData & - populated structure
    *
-   *  @returns ErrorCode         - error code
+   *  @returns ErrorCode           - error code
    * */
   ErrorCode setTextureLoadType(const std::string &rowData,
-                               CombinedData &outData);
+                               BuilderCombinedData &outData);
+
+  /** @brief used to estimate the glyph atlas size (in pixels), needed
+   *         to hold the printable ASCII glyphs at the declared fontSize.
+   *
+   *  @param BuilderCombinedData & - populated structure
+   * */
+  void estimateFontAtlasSize(BuilderCombinedData &outData) const;
+
+  /** @brief used fill CombinedData description when
+   *                                  optional "group" tag is processed.
+   *
+   *  @param const std::string &   - parsed row data
+   *  @param BuilderCombinedData & - populated structure
+   *
+   *  @returns ErrorCode           - error code
+   * */
+  ErrorCode setLoadGroup(const std::string &rowData,
+                         BuilderCombinedData &outData);
+
+  /** @brief used fill CombinedData description when
+   *                                   optional "lods" tag is processed.
+   *
+   *  @param const std::string &   - parsed row data
+   *  @param BuilderCombinedData & - populated structure
+   *
+   *  @returns ErrorCode           - error code
+   * */
+  ErrorCode setLodScales(const std::string &rowData,
+                         BuilderCombinedData &outData);
 
   void resetInternals();
 
@@ -157,6 +194,7 @@ private:
    *  unnecessary overhead.
    * */
   std::string _projectAbsFilePath;
+  std::string _outputAbsFilePath;
   std::string _projectFolder;
   std::string _startDir;
   std::string _currAbsFilePath;
@@ -177,10 +215,10 @@ private:
   /** Counters for total widget, fonts + sound file sizes - used to
    *  later on perform a proper drawing of the loading screen progress bar
    * */
-  int32_t _staticResFileTotalSize;
-  int32_t _dynamicResFileTotalSize;
-  int32_t _fontFileTotalSize;
-  int32_t _soundFileTotalSize;
+  uint64_t _staticResFileTotalSize;
+  uint64_t _dynamicResFileTotalSize;
+  uint64_t _fontFileTotalSize;
+  uint64_t _soundFileTotalSize;
 
   /* Name of the stream that is currently being processed. */
   std::ifstream _sourceStream;
@@ -194,8 +232,15 @@ private:
   /* Used to catch syntax errors in the .rsrc files */
   SyntaxChecker _syntaxChecker;
 
+  /* Used to account and enforce the decoded texture memory budgets */
+  TextureBudget _textureBudget;
+
   /* A vector that holds all parsed data from an individual .rsrc file */
-  std::vector<CombinedData> _fileData;
+  std::vector<BuilderCombinedData> _fileData;
+
+  /* Serializes the resource_builder instances writing into
+   * the same output directory */
+  FileLock _outputLock;
 
   /* A sanity checker for finding duplicate files or file paths */
   std::unordered_set<std::string> _uniqueFiles;
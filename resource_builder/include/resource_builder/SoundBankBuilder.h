@@ -0,0 +1,90 @@
+#ifndef TOOLS_RESOURCE_BUILDER_INCLUDE_SOUNDBANKBUILDER_H_
+#define TOOLS_RESOURCE_BUILDER_INCLUDE_SOUNDBANKBUILDER_H_
+
+// System headers
+#include <cstdint>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+// Other libraries headers
+#include "utils/ErrorCode.h"
+
+// Own components headers
+#include "resource_builder/AtomicFileStream.h"
+
+// Forward declarations
+struct BuilderCombinedData;
+
+/* Location of a single sound chunk payload inside the sound bank */
+struct SoundBankSlot {
+  /* Offset from the start of the sound bank file (in bytes) */
+  uint64_t offset = 0;
+
+  /* Size of the original sound file (in bytes) */
+  uint64_t size = 0;
+};
+
+/* Concatenates the payloads of all 'chunk' sounds of a project into
+ * a single sound bank file, so the sound initialization becomes one
+ * sequential read instead of a file open per sound.
+ *
+ * Every payload starts on a SOUND_BANK_ALIGNMENT boundary.
+ * 'music' sounds are not packed - they keep streaming from their files.
+ * */
+class SoundBankBuilder {
+ public:
+  /** @brief used to open the sound bank file
+   *
+   *  @param const std::string & - sound bank file name
+   *
+   *  @returns ErrorCode         - error code
+   * */
+  ErrorCode openBankStream(const std::string& fileName);
+
+  /** @brief used to append the payloads of all 'chunk' sounds
+   *
+   *  @param const std::vector<BuilderCombinedData> & - the parsed data
+   *                                                   from all .rsrc files
+   *
+   *  @returns ErrorCode                             - error code
+   * */
+  ErrorCode writeData(const std::vector<BuilderCombinedData>& data);
+
+  /** @brief used to obtain the location of a packed sound
+   *
+   *  @param const uint64_t  - sound hash value
+   *  @param SoundBankSlot & - sound location
+   *
+   *  @returns bool          - is the sound packed or not
+   * */
+  bool getSlot(const uint64_t hashValue, SoundBankSlot& outSlot) const;
+
+  /** @brief used to publish the fully written sound bank file
+   *
+   *  @param const bool  - whether the file should be flushed to the
+   *                       storage device before being published
+   *
+   *  @returns ErrorCode - error code
+   * */
+  ErrorCode publishBankStream(const bool syncToDisk);
+
+  /** @brief used to close the sound bank file
+   *         NOTE: unpublished file is discarded
+   * */
+  void closeBankStream();
+
+  /* Alignment of every payload inside the sound bank */
+  static constexpr uint64_t SOUND_BANK_ALIGNMENT = 16;
+
+ private:
+  AtomicFileStream _bankStream;
+
+  /* hash value -> payload location */
+  std::unordered_map<uint64_t, SoundBankSlot> _slots;
+
+  /* Current sound bank file size (in bytes) */
+  uint64_t _bankSize = 0;
+};
+
+#endif /* TOOLS_RESOURCE_BUILDER_INCLUDE_SOUNDBANKBUILDER_H_ */
@@ -0,0 +1,69 @@
+#ifndef TOOLS_RESOURCE_BUILDER_INCLUDE_SPRITEGRID_H_
+#define TOOLS_RESOURCE_BUILDER_INCLUDE_SPRITEGRID_H_
+
+// System headers
+#include <cstdint>
+#include <vector>
+
+// Other libraries headers
+#include "utils/drawing/Rectangle.h"
+
+// Own components headers
+
+// Forward declarations
+
+/* Constant size descriptor of an evenly spaced sprite sheet.
+ *
+ * Frames are laid out row by row, starting from the origin:
+ *      > horizontal layout - columns == count;
+ *      > vertical layout   - columns == 1;
+ *      > mixed layout      - any other columns value
+ *                            (the last row may be partially filled);
+ *
+ * Combined resource file record (replaces the expanded frame list):
+ *      grid <count> <columns> <originX> <originY> <frameWidth>
+ *           <frameHeight> <spacingX> <spacingY>
+ * */
+struct SpriteGrid {
+  /** @brief used to compute the rectangle of a single frame in O(1).
+   *         This is the reference routine for the runtime loaders.
+   *
+   *  @param const uint32_t - frame index [0, count)
+   *
+   *  @returns Rectangle    - frame rectangle within the source image
+   * */
+  Rectangle getFrame(const uint32_t idx) const {
+    const int32_t column = static_cast<int32_t>(idx % columns);
+    const int32_t row = static_cast<int32_t>(idx / columns);
+
+    return Rectangle(originX + (column * (frameWidth + spacingX)),  // x
+                     originY + (row * (frameHeight + spacingY)),    // y
+                     frameWidth,                                    // w
+                     frameHeight);                                  // h
+  }
+
+  /** @brief used to describe already expanded frames with a grid.
+   *
+   *  @param const std::vector<Rectangle> & - expanded frames
+   *  @param SpriteGrid &                   - populated grid
+   *
+   *  @returns bool - whether every frame is exactly reproduced
+   *                  by the grid or not
+   * */
+  static bool fromFrames(const std::vector<Rectangle>& frames,
+                         SpriteGrid& outGrid);
+
+  int32_t originX = 0;
+  int32_t originY = 0;
+  int32_t frameWidth = 0;
+  int32_t frameHeight = 0;
+
+  /* Gaps between two neighbouring frames */
+  int32_t spacingX = 0;
+  int32_t spacingY = 0;
+
+  uint32_t count = 0;
+  uint32_t columns = 0;
+};
+
+#endif /* TOOLS_RESOURCE_BUILDER_INCLUDE_SPRITEGRID_H_ */
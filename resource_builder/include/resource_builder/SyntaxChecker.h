@@ -104,6 +104,34 @@
  *      description=chunk,medium
  *      or
  *      description=music,very_high
+ *
+ *      > Optional load group (applicable to every type)
+ *          - group       - name of the load group [a-zA-Z0-9_-]
+ *                          Must directly follow the last field of an entry
+ *
+ *      Example:
+ *      tag=[LEVEL_1_BACKGROUND]
+ *      type=image
+ *      path=p/level_1_background.png
+ *      description=empty
+ *      position=0,0
+ *      load=on_demand
+ *      group=level_1
+ *
+ *      > Optional LOD scales (applicable to image, sprite and sprite_manual)
+ *          - lods        - comma separated scales in the (0, 1] range.
+ *                          Downscaled copies of the image are generated
+ *                          for every scale below 1
+ *                          Must directly follow the last field of an entry
+ *
+ *      Example:
+ *      tag=[LEVEL_1_BACKGROUND]
+ *      type=image
+ *      path=p/level_1_background.png
+ *      description=empty
+ *      position=0,0
+ *      load=on_demand
+ *      lods=1,0.5,0.25
  * */
 class SyntaxChecker {
  public:
@@ -118,6 +146,24 @@ class SyntaxChecker {
    * */
   bool hasValidTag(const std::string& line);
 
+  /** @brief used to determine whether the line holds the optional
+   *                    'group' tag of the previously completed entry.
+   *
+   *  @param const std::string & - data to be checked
+   *
+   *  @returns bool - is group tag or not
+   * */
+  bool isGroupTag(const std::string& line) const;
+
+  /** @brief used to determine whether the line holds the optional
+   *                     'lods' tag of the previously completed entry.
+   *
+   *  @param const std::string & - data to be checked
+   *
+   *  @returns bool - is lods tag or not
+   * */
+  bool isLodsTag(const std::string& line) const;
+
   /** @brief used to update order
    *              (in order to know which is the next tag to be expected)
    * */
@@ -194,6 +240,8 @@ class SyntaxChecker {
   const std::string _DESCR_STR;
   const std::string _POS_STR;
   const std::string _LOAD_STR;
+  const std::string _GROUP_STR;
+  const std::string _LODS_STR;
 
   /**  Sizes of individual tag in order to check for syntax errors
    *                           in each individual provided tag run-time
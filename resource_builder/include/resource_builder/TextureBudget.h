@@ -0,0 +1,140 @@
+#ifndef TOOLS_RESOURCE_BUILDER_INCLUDE_TEXTUREBUDGET_H_
+#define TOOLS_RESOURCE_BUILDER_INCLUDE_TEXTUREBUDGET_H_
+
+// System headers
+#include <cstdint>
+#include <string>
+#include <vector>
+
+// Other libraries headers
+#include "utils/ErrorCode.h"
+
+// Own components headers
+#include "resource_builder/ResourceBuilderConfig.h"
+
+// Forward declarations
+struct BuilderCombinedData;
+
+/* Accounts the decoded (GPU) memory of the image entries and enforces
+ * the configured texture memory budgets.
+ *
+ * The decoded size of an entry is width * height * 4 bytes - the RGBA8
+ * texture, which is uploaded at runtime, no matter how well the file
+ * on disk is compressed. Sprites are accounted with their whole image.
+ * GPU compressed textures (.ktx2, .dds, .astc) are accounted with the
+ * size of all their mip levels and layers, as they are uploaded as is.
+ *
+ * Budgets are checked:
+ *      > per entry;
+ *      > per .rsrc file (sum of it's entries);
+ *      > per project for the on_init and the on_demand entries;
+ *
+ * An exceeded budget fails the build or is reported as a warning,
+ * depending on the configured action. The decoded memory of every .rsrc
+ * file is reported at the end of the build, whether a budget is
+ * exceeded or not.
+ * */
+class TextureBudget {
+ public:
+  TextureBudget();
+
+  /** @brief used to set the budgets and the exceeded budget action
+   *
+   *  @param const TextureBudgets & - configured budgets
+   * */
+  void init(const TextureBudgets& budgets);
+
+  /** @brief used to account the entries of a single .rsrc file and
+   *         check the entry and the .rsrc file budgets
+   *
+   *  @param const std::string &                     - .rsrc file name
+   *  @param const std::vector<BuilderCombinedData> & - the parsed data
+   *                                                   of the .rsrc file
+   *
+   *  @returns ErrorCode - error code (FAILURE only if a budget is
+   *                       exceeded and the action is BudgetAction::FAIL)
+   * */
+  ErrorCode checkResourceFile(const std::string& fileName,
+                              const std::vector<BuilderCombinedData>& data);
+
+  /** @brief used to check the project wide on_init and on_demand budgets
+   *         of the accounted entries
+   *
+   *  @returns ErrorCode - error code (FAILURE only if a budget is
+   *                       exceeded and the action is BudgetAction::FAIL)
+   * */
+  ErrorCode checkProject() const;
+
+  /** @brief used to obtain the decoded memory of the on_init entries
+   *
+   *  @returns uint64_t - decoded memory in bytes
+   * */
+  uint64_t getOnInitSize() const { return _onInitSize; }
+
+  /** @brief used to obtain the decoded memory of the on_demand entries
+   *
+   *  @returns uint64_t - decoded memory in bytes
+   * */
+  uint64_t getOnDemandSize() const { return _onDemandSize; }
+
+  /** @brief used to log the decoded memory of every accounted .rsrc file
+   * */
+  void logReport() const;
+
+  /** @brief used to forget the accounted entries
+   * */
+  void reset();
+
+  /** @brief used to obtain the decoded memory of an image entry
+   *
+   *  @param const BuilderCombinedData & - image entry
+   *
+   *  @returns uint64_t - decoded (or GPU compressed) memory in bytes
+   *                      (0 for fonts, sounds and unknown dimensions)
+   * */
+  static uint64_t getDecodedSize(const BuilderCombinedData& entry);
+
+  /** @brief used to parse a size in bytes with an optional binary
+   *         suffix: K (KiB), M (MiB) or G (GiB). E.g. 512K, 96M, 1G
+   *
+   *  @param const std::string & - size text
+   *  @param uint64_t &          - parsed size in bytes
+   *
+   *  @returns bool              - is the size valid or not
+   * */
+  static bool parseSize(const std::string& text, uint64_t& outSize);
+
+  /* Decoded (RGBA8) texture bytes per pixel */
+  static constexpr uint64_t DECODED_BYTES_PER_PIXEL = 4;
+
+ private:
+  /* Decoded memory of the entries of a single .rsrc file */
+  struct ResourceFileSize {
+    std::string fileName;
+    uint64_t onInitSize = 0;
+    uint64_t onDemandSize = 0;
+  };
+
+  /** @brief used to report an exceeded budget
+   *
+   *  @param const char *        - budget scope
+   *  @param const std::string & - name of the accounted item
+   *  @param const uint64_t      - decoded memory in bytes
+   *  @param const uint64_t      - budget in bytes
+   *
+   *  @returns ErrorCode         - FAILURE if the build should fail
+   * */
+  ErrorCode reportExceeded(const char* scope, const std::string& name,
+                           const uint64_t size, const uint64_t budget) const;
+
+  TextureBudgets _budgets;
+
+  /* Decoded memory of the project on_init and on_demand entries */
+  uint64_t _onInitSize;
+  uint64_t _onDemandSize;
+
+  /* Decoded memory of the accounted .rsrc files in the order of parsing */
+  std::vector<ResourceFileSize> _resourceFileSizes;
+};
+
+#endif /* TOOLS_RESOURCE_BUILDER_INCLUDE_TEXTUREBUDGET_H_ */
@@ -0,0 +1,108 @@
+#ifndef TOOLS_RESOURCE_BUILDER_INCLUDE_TEXTURECACHEBUILDER_H_
+#define TOOLS_RESOURCE_BUILDER_INCLUDE_TEXTURECACHEBUILDER_H_
+
+// System headers
+#include <cstdint>
+#include <string>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+
+// Other libraries headers
+#include "utils/ErrorCode.h"
+
+// Own components headers
+#include "resource_builder/ResourceBuilderConfig.h"
+
+// Forward declarations
+struct BuilderCombinedData;
+struct RgbaImage;
+
+/* Pre-decodes the images of the project into raw RGBA8 blobs, so the
+ * runtime texture loading becomes a mmap and an upload (no decoding).
+ *
+ * Blobs are written inside the textures folder (next to the combined
+ * resource file) and are named after the content digest of the source
+ * file - unchanged images are neither read nor decoded again on the next
+ * build.
+ *
+ * Blob layout (little endian):
+ *      offset  0: char[4]  magic "RGBA"
+ *      offset  4: uint32_t version
+ *      offset  8: uint32_t width
+ *      offset 12: uint32_t height
+ *      offset 16: uint32_t flags (bit 0 - premultiplied alpha)
+ *      offset 20: uint32_t reserved (0)
+ *      offset 24: uint64_t pixel data size in bytes
+ *      offset 32: width * height * 4 bytes of pixel data, rows top to bottom
+ *
+ * NOTE: only PNG images are decoded. The other formats are skipped with
+ *       a warning and remain decoded at runtime.
+ * */
+class TextureCacheBuilder {
+ public:
+  TextureCacheBuilder();
+
+  /** @brief used to set the pre-decoding mode
+   *
+   *  @param const TextureCacheMode - pre-decoding mode
+   * */
+  void init(const TextureCacheMode mode);
+
+  /** @brief used to produce the blobs of all image entries
+   *
+   *  @param const std::string &                     - combined files folder
+   *  @param const std::vector<BuilderCombinedData> & - the parsed data
+   *                                                   from all .rsrc files
+   *  @param const bool                              - whether the files
+   *                          should be flushed to the storage device
+   *
+   *  @returns ErrorCode                             - error code
+   * */
+  ErrorCode writeData(const std::string& destDir,
+                      const std::vector<BuilderCombinedData>& data,
+                      const bool syncToDisk);
+
+  /** @brief used to obtain the blob name of an image entry
+   *
+   *  @param const uint64_t - resource hash value
+   *  @param std::string &  - blob file name, relative to the combined
+   *                          files folder
+   *
+   *  @returns bool         - does the entry have a blob or not
+   * */
+  bool getBlobName(const uint64_t hashValue, std::string& outName) const;
+
+  /** @brief used to remove the blobs, which are no longer referenced
+   *
+   *  @param const std::string & - combined files folder
+   * */
+  void removeStaleBlobs(const std::string& destDir) const;
+
+  /** @brief used to forget the blobs of the last build
+   * */
+  void reset();
+
+ private:
+  /** @brief used to write a single blob
+   *
+   *  @param RgbaImage &         - decoded image (premultiplied in place
+   *                               if requested)
+   *  @param const std::string & - blob file name
+   *  @param const bool          - sync to disk
+   *
+   *  @returns ErrorCode         - error code
+   * */
+  ErrorCode writeBlob(RgbaImage& image, const std::string& fileName,
+                      const bool syncToDisk) const;
+
+  /* resource hash value -> blob name (relative) */
+  std::unordered_map<uint64_t, std::string> _blobNames;
+
+  /* blob names, which are referenced by the last build */
+  std::unordered_set<std::string> _usedBlobNames;
+
+  TextureCacheMode _mode;
+};
+
+#endif /* TOOLS_RESOURCE_BUILDER_INCLUDE_TEXTURECACHEBUILDER_H_ */
@@ -0,0 +1,181 @@
+#ifndef TOOLS_RESOURCE_BUILDER_INCLUDE_TRUETYPEFONT_H_
+#define TOOLS_RESOURCE_BUILDER_INCLUDE_TRUETYPEFONT_H_
+
+// System headers
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+// Other libraries headers
+#include "utils/ErrorCode.h"
+
+// Own components headers
+
+// Forward declarations
+
+/* Rasterized glyph. Bearings are in pixels relative to the pen position
+ * on the baseline (bearingY points upwards to the top bitmap row) */
+struct GlyphBitmap {
+  int32_t advance = 0;
+  int32_t bearingX = 0;
+  int32_t bearingY = 0;
+  uint32_t width = 0;
+  uint32_t height = 0;
+
+  /* width * height coverage values, rows stored top to bottom */
+  std::vector<uint8_t> coverage;
+};
+
+/* Minimal TrueType glyph rasterizer, used for the offline glyph atlases.
+ *
+ * Supports 'glyf' outlines (simple and composite glyphs) together with
+ * 'cmap' format 4 and 12 subtables. CFF based OpenType fonts ('OTTO')
+ * are not supported. For font collections the first font is used.
+ *
+ * Outlines are flattened into line segments and rasterized with exact
+ * signed area coverage accumulation (no hinting).
+ * */
+class TrueTypeFont {
+ public:
+  TrueTypeFont();
+
+  /** @brief used to load and validate the font file
+   *
+   *  @param const std::string & - absolute font file name
+   *
+   *  @returns ErrorCode         - error code
+   * */
+  ErrorCode load(const std::string& fileName);
+
+  /** @brief used to obtain the glyph scale for the provided pixel size
+   *
+   *  @param const int32_t - font size in pixels (em size)
+   *
+   *  @returns float       - font units to pixels scale
+   * */
+  float getScale(const int32_t pixelSize) const;
+
+  /** @brief used to find the glyph index of a unicode codepoint
+   *
+   *  @param const uint32_t - unicode codepoint
+   *
+   *  @returns uint32_t     - glyph index (0 - the missing glyph)
+   * */
+  uint32_t findGlyphIndex(const uint32_t codepoint) const;
+
+  /** @brief used to rasterize a single glyph
+   *
+   *  @param const uint32_t - glyph index
+   *  @param const float    - font units to pixels scale
+   *  @param GlyphBitmap &  - rasterized glyph
+   *
+   *  @returns ErrorCode    - error code
+   * */
+  ErrorCode rasterizeGlyph(const uint32_t glyphIdx, const float scale,
+                           GlyphBitmap& outGlyph) const;
+
+ private:
+  /* Outline point in font units */
+  struct OutlinePoint {
+    float x = 0.f;
+    float y = 0.f;
+    bool onCurve = false;
+  };
+
+  using Contour = std::vector<OutlinePoint>;
+
+  /* Affine transformation of composite glyph components:
+   *    x' = a * x + c * y + e
+   *    y' = b * x + d * y + f
+   * */
+  struct Transform {
+    float a = 1.f;
+    float b = 0.f;
+    float c = 0.f;
+    float d = 1.f;
+    float e = 0.f;
+    float f = 0.f;
+  };
+
+  /** @brief used to locate and validate the used sfnt tables
+   *
+   *  @returns ErrorCode - error code
+   * */
+  ErrorCode locateTables();
+
+  /** @brief used to select the best unicode character map subtable
+   *
+   *  @returns ErrorCode - error code
+   * */
+  ErrorCode selectCharacterMap();
+
+  /** @brief used to obtain the location of the glyph data inside 'glyf'
+   *
+   *  @param const uint32_t - glyph index
+   *  @param size_t &       - glyph data offset
+   *  @param size_t &       - glyph data size (0 for empty glyphs)
+   *
+   *  @returns bool         - is the glyph location valid or not
+   * */
+  bool getGlyphRange(const uint32_t glyphIdx, size_t& outOffset,
+                     size_t& outSize) const;
+
+  /** @brief used to append the transformed contours of a glyph
+   *
+   *  @param const uint32_t        - glyph index
+   *  @param const Transform &     - transformation to apply
+   *  @param const uint32_t        - composite glyph nesting depth
+   *  @param std::vector<Contour>& - produced contours
+   *
+   *  @returns ErrorCode           - error code
+   * */
+  ErrorCode appendGlyphContours(const uint32_t glyphIdx,
+                                const Transform& transform,
+                                const uint32_t depth,
+                                std::vector<Contour>& outContours) const;
+
+  ErrorCode appendSimpleGlyphContours(const size_t glyphOffset,
+                                      const size_t glyphSize,
+                                      const int32_t contoursCount,
+                                      const Transform& transform,
+                                      std::vector<Contour>& outContours) const;
+
+  ErrorCode appendCompositeGlyphContours(
+      const size_t glyphOffset, const size_t glyphSize,
+      const Transform& transform, const uint32_t depth,
+      std::vector<Contour>& outContours) const;
+
+  /* Big endian readers. Out of range reads produce 0 */
+  uint8_t readU8(const size_t offset) const;
+  uint16_t readU16(const size_t offset) const;
+  int16_t readS16(const size_t offset) const;
+  uint32_t readU32(const size_t offset) const;
+
+  std::vector<uint8_t> _data;
+  std::string _fileName;
+
+  /* Offsets of the used sfnt tables within _data */
+  size_t _headOffset;
+  size_t _locaOffset;
+  size_t _locaSize;
+  size_t _glyfOffset;
+  size_t _glyfSize;
+  size_t _hheaOffset;
+  size_t _hmtxOffset;
+  size_t _hmtxSize;
+  size_t _maxpOffset;
+  size_t _cmapOffset;
+  size_t _cmapSize;
+
+  /* Offset of the selected character map subtable */
+  size_t _charMapOffset;
+  uint16_t _charMapFormat;
+
+  uint32_t _unitsPerEm;
+  uint32_t _glyphCount;
+  uint32_t _horizontalMetricsCount;
+  bool _isLongLocaFormat;
+};
+
+#endif /* TOOLS_RESOURCE_BUILDER_INCLUDE_TRUETYPEFONT_H_ */
@@ -0,0 +1,114 @@
+// Corresponding header
+#include "resource_builder/AccessTrace.h"
+
+// System headers
+#include <algorithm>
+#include <cctype>
+#include <cinttypes>
+#include <fstream>
+
+// Other libraries headers
+#include "utils/debug/StrError.h"
+#include "utils/log/Log.h"
+
+// Own components headers
+#include "resource_builder/BuilderStructs.h"
+
+namespace {
+constexpr auto HEX_BASE = 16;
+constexpr auto MAX_UINT64_T_HEX_LENGTH = 16;
+
+/** @brief used to parse a single "0x<hex>" or "<hex>" trace value
+ * */
+bool parseHashValue(const std::string& line, uint64_t& outValue) {
+  size_t pos = 0;
+  if ((2 <= line.size()) && ('0' == line[0]) &&
+      (('x' == line[1]) || ('X' == line[1]))) {
+    pos = 2;
+  }
+
+  const size_t digitsCount = line.size() - pos;
+  if ((0 == digitsCount) || (MAX_UINT64_T_HEX_LENGTH < digitsCount)) {
+    return false;
+  }
+
+  outValue = 0;
+  for (; pos < line.size(); ++pos) {
+    const unsigned char letter = static_cast<unsigned char>(line[pos]);
+    if (!isxdigit(letter)) {
+      return false;
+    }
+
+    const uint64_t digit = isdigit(letter)
+        ? static_cast<uint64_t>(letter - '0')
+        : static_cast<uint64_t>(tolower(letter) - 'a' + 10);
+    outValue = (outValue * HEX_BASE) + digit;
+  }
+
+  return true;
+}
+}
+
+ErrorCode AccessTrace::load(const std::string& fileName) {
+  std::ifstream traceStream(fileName.c_str(), std::ifstream::in);
+  if (!traceStream) {
+    LOGERR("Error, could not open access trace: %s, reason: %s",
+           fileName.c_str(), strError().c_str());
+    return ErrorCode::FAILURE;
+  }
+
+  _ranks.clear();
+
+  std::string line;
+  uint64_t lineNumber = 0;
+  uint64_t hashValue = 0;
+  while (std::getline(traceStream, line)) {
+    ++lineNumber;
+
+    // strip windows line endings and surrounding whitespaces
+    line.erase(std::remove_if(line.begin(), line.end(), [](char letter) {
+      return isspace(static_cast<unsigned char>(letter));
+    }), line.end());
+
+    if (line.empty() || ('#' == line[0])) {
+      continue;
+    }
+
+    if (!parseHashValue(line, hashValue)) {
+      LOGERR("Error, invalid hash value: [%s] on line: %" PRIu64
+             " of access trace: %s", line.c_str(), lineNumber,
+             fileName.c_str());
+      _ranks.clear();
+      return ErrorCode::FAILURE;
+    }
+
+    // only the first use is relevant
+    _ranks.emplace(hashValue, static_cast<uint64_t>(_ranks.size()));
+  }
+
+  LOG("Loaded access trace: %s with %zu unique entries", fileName.c_str(),
+      _ranks.size());
+
+  return ErrorCode::SUCCESS;
+}
+
+uint64_t AccessTrace::getRank(const uint64_t hashValue) const {
+  const auto it = _ranks.find(hashValue);
+  if (_ranks.end() == it) {
+    return UNSEEN_RANK;
+  }
+
+  return it->second;
+}
+
+void AccessTrace::sortEntries(
+    std::vector<BuilderCombinedData>& entries) const {
+  if (_ranks.empty()) {
+    return;
+  }
+
+  std::stable_sort(entries.begin(), entries.end(),
+      [this](const BuilderCombinedData& lhs, const BuilderCombinedData& rhs) {
+        return getRank(lhs.header.hashValue) < getRank(rhs.header.hashValue);
+      });
+}
@@ -0,0 +1,141 @@
+// Corresponding header
+#include "resource_builder/AssetLinter.h"
+
+// System headers
+#include <algorithm>
+#include <cinttypes>
+#include <string>
+
+// Other libraries headers
+#include "utils/log/Log.h"
+
+// Own components headers
+#include "resource_builder/BuilderStructs.h"
+#include "resource_builder/ResourceBuilderConfig.h"
+#include "resource_builder/TextureBudget.h"
+
+namespace {
+constexpr double BYTES_PER_MB = 1024.0 * 1024.0;
+
+/* Progressive JPEG decoding is roughly 3 times slower than the baseline
+ * decoding - the extra cost is twice the decoded size */
+constexpr uint64_t PROGRESSIVE_EXTRA_PASSES = 2;
+
+/* Deinterlacing touches every pixel once more, on top of inflating
+ * 7 reduced (worse compressible) images - estimated as a half pass */
+constexpr uint64_t INTERLACE_COST_DIVIDER = 2;
+
+constexpr uint32_t HIGH_BIT_DEPTH = 16;
+
+/* Images are reported as huge from 1 MB of decoded memory, when less
+ * than a quarter of their pixels are covered by the sprite frames */
+constexpr uint64_t HUGE_IMAGE_DECODED_SIZE = 1024 * 1024;
+constexpr double MIN_USED_AREA_RATIO = 0.25;
+
+bool isPowerOfTwo(const int32_t value) {
+  return (0 < value) && (0 == (value & (value - 1)));
+}
+
+uint64_t nextPowerOfTwo(const int32_t value) {
+  uint64_t result = 1;
+  while (result < static_cast<uint64_t>(value)) {
+    result <<= 1;
+  }
+  return result;
+}
+}
+
+AssetLinter::AssetLinter() : _hasDefaultLods(false) {}
+
+void AssetLinter::init(const ResourceBuilderConfig& config) {
+  _hasDefaultLods = !config.lodScales.empty();
+}
+
+void AssetLinter::lint(const std::vector<BuilderCombinedData>& data) const {
+  std::vector<Finding> findings;
+  for (const auto& entry : data) {
+    if (("font" != entry.type) && ("sound" != entry.type)) {
+      lintEntry(entry, findings);
+    }
+  }
+
+  std::stable_sort(findings.begin(), findings.end(),
+      [](const Finding& lhs, const Finding& rhs) {
+        return lhs.cost > rhs.cost;
+      });
+
+  uint64_t totalCost = 0;
+  for (const auto& finding : findings) {
+    totalCost += finding.cost;
+  }
+
+  LOG("Lint report - %zu findings with estimated load cost of %.3f MB",
+      findings.size(), static_cast<double>(totalCost) / BYTES_PER_MB);
+  for (size_t i = 0; i < findings.size(); ++i) {
+    LOGR("  %zu. %s - %s (est. cost: %.3f MB)", i + 1,
+         findings[i].path.c_str(), findings[i].description.c_str(),
+         static_cast<double>(findings[i].cost) / BYTES_PER_MB);
+  }
+}
+
+void AssetLinter::lintEntry(const BuilderCombinedData& entry,
+                            std::vector<Finding>& outFindings) const {
+  const uint64_t decodedSize = TextureBudget::getDecodedSize(entry);
+  if (0 == decodedSize) {
+    return;
+  }
+
+  const ImageInfo& info = entry.imageInfo;
+  if (info.progressive) {
+    outFindings.push_back({ entry.header.path,
+        "progressive JPEG, re-encode as baseline",
+        decodedSize * PROGRESSIVE_EXTRA_PASSES });
+  }
+
+  if (info.interlaced) {
+    outFindings.push_back({ entry.header.path,
+        "Adam7 interlaced PNG, re-encode as non interlaced",
+        decodedSize / INTERLACE_COST_DIVIDER });
+  }
+
+  if (HIGH_BIT_DEPTH == info.bitDepth) {
+    outFindings.push_back({ entry.header.path,
+        "16 bit per sample PNG, reduce to 8 bit", decodedSize });
+  }
+
+  // GPU compressed textures carry their own mip levels instead of LODs
+  const bool hasLods = (TextureContainer::NONE == info.container) &&
+                       (_hasDefaultLods || !entry.lodScales.empty());
+  if (hasLods && (!isPowerOfTwo(entry.imageRect.w) ||
+                  !isPowerOfTwo(entry.imageRect.h))) {
+    const uint64_t paddedSize = nextPowerOfTwo(entry.imageRect.w) *
+                                nextPowerOfTwo(entry.imageRect.h) *
+                                TextureBudget::DECODED_BYTES_PER_PIXEL;
+    outFindings.push_back({ entry.header.path,
+        "non power of two image with LODs (" +
+        std::to_string(entry.imageRect.w) + "x" +
+        std::to_string(entry.imageRect.h) + ")",
+        paddedSize - decodedSize });
+  }
+
+  if (("image" != entry.type) && (HUGE_IMAGE_DECODED_SIZE <= decodedSize)) {
+    uint64_t usedArea = 0;
+    for (const auto& sprite : entry.spriteData) {
+      usedArea += static_cast<uint64_t>(std::max(sprite.w, 0)) *
+                  static_cast<uint64_t>(std::max(sprite.h, 0));
+    }
+
+    const uint64_t imageArea =
+        static_cast<uint64_t>(entry.imageRect.w) * entry.imageRect.h;
+    const double usedRatio =
+        static_cast<double>(usedArea) / static_cast<double>(imageArea);
+    if (usedRatio < MIN_USED_AREA_RATIO) {
+      outFindings.push_back({ entry.header.path,
+          "huge image, the frames use only " +
+          std::to_string(static_cast<int32_t>(usedRatio * 100.0)) +
+          "% of it's pixels",
+          decodedSize - static_cast<uint64_t>(
+              usedRatio * static_cast<double>(decodedSize)) });
+    }
+  }
+}
@@ -0,0 +1,151 @@
+// Corresponding header
+#include "resource_builder/AtomicFileStream.h"
+
+// System headers
+#include <cstdint>
+#include <filesystem>
+#include <system_error>
+
+#if defined(_WIN32) || defined(_WIN64)
+  #include <fcntl.h>
+  #include <io.h>
+#else //linux
+  #include <fcntl.h>
+  #include <unistd.h>
+#endif
+
+// Other libraries headers
+#include "utils/debug/StrError.h"
+#include "utils/log/Log.h"
+
+// Own components headers
+
+namespace {
+constexpr auto TEMP_FILE_SUFFIX = ".tmp";
+
+/** @brief used to flush the data of an already closed file
+ *                                               to the storage device.
+ * */
+ErrorCode syncToStorage(const std::string& fileName) {
+#if defined(_WIN32) || defined(_WIN64)
+  const int32_t fd = _open(fileName.c_str(), _O_RDWR | _O_BINARY);
+  if (0 > fd) {
+    LOGERR("Error, could not open: %s for sync, reason: %s",
+           fileName.c_str(), strError().c_str());
+    return ErrorCode::FAILURE;
+  }
+
+  const bool success = (0 == _commit(fd));
+  _close(fd);
+#else //linux
+  const int32_t fd = open(fileName.c_str(), O_RDONLY);
+  if (0 > fd) {
+    LOGERR("Error, could not open: %s for sync, reason: %s",
+           fileName.c_str(), strError().c_str());
+    return ErrorCode::FAILURE;
+  }
+
+  const bool success = (0 == fsync(fd));
+  close(fd);
+#endif
+
+  if (!success) {
+    LOGERR("Error, sync failed for: %s, reason: %s", fileName.c_str(),
+           strError().c_str());
+    return ErrorCode::FAILURE;
+  }
+
+  return ErrorCode::SUCCESS;
+}
+}
+
+AtomicFileStream::~AtomicFileStream() noexcept { discard(); }
+
+ErrorCode AtomicFileStream::begin(const std::string& fileName) {
+  // drop any leftovers from a previous unfinished write
+  discard();
+
+  _fileName = fileName;
+  _tempFileName = fileName;
+  _tempFileName.append(TEMP_FILE_SUFFIX);
+
+  open(_tempFileName.c_str(),
+       std::ofstream::out | std::ofstream::binary | std::ofstream::trunc);
+
+  if (!*this) {
+    LOGERR("Error, could not open ofstream for fileName: %s, reason: %s",
+           _tempFileName.c_str(), strError().c_str());
+    return ErrorCode::FAILURE;
+  }
+
+  return ErrorCode::SUCCESS;
+}
+
+ErrorCode AtomicFileStream::publish(const bool syncToDisk) {
+  if (!is_open()) {
+    LOGERR("Internal error, ofstream for %s not opened", _fileName.c_str());
+    return ErrorCode::FAILURE;
+  }
+
+  flush();
+  const bool writeSuccess = static_cast<bool>(*this);
+  close();
+  clear();
+
+  if (!writeSuccess) {
+    LOGERR("Error, write failed for fileName: %s, reason: %s",
+           _tempFileName.c_str(), strError().c_str());
+    discard();
+    return ErrorCode::FAILURE;
+  }
+
+  if (syncToDisk && (ErrorCode::SUCCESS != syncToStorage(_tempFileName))) {
+    LOGERR("Error in syncToStorage() for %s", _tempFileName.c_str());
+    discard();
+    return ErrorCode::FAILURE;
+  }
+
+  std::error_code errorCode;
+  std::filesystem::rename(_tempFileName, _fileName, errorCode);
+  if (errorCode) {
+    LOGERR("Error, could not rename %s to %s, reason: %s",
+           _tempFileName.c_str(), _fileName.c_str(),
+           errorCode.message().c_str());
+    discard();
+    return ErrorCode::FAILURE;
+  }
+
+  // the temporary file no longer exists
+  _tempFileName.clear();
+
+#if !defined(_WIN32) && !defined(_WIN64)
+  // the rename itself is durable only after the directory entry is synced.
+  // The new file is already published at this point, so a failure can not
+  // be reported as a failed write
+  if (syncToDisk) {
+    const std::string parentDir =
+        std::filesystem::path(_fileName).parent_path().string();
+    if (ErrorCode::SUCCESS != syncToStorage(parentDir)) {
+      LOGR("Warning, %s is published, but the rename may not survive "
+           "a power loss. Could not sync directory: %s", _fileName.c_str(),
+           parentDir.c_str());
+    }
+  }
+#endif
+
+  return ErrorCode::SUCCESS;
+}
+
+void AtomicFileStream::discard() {
+  if (is_open()) {
+    close();
+  }
+  // reset stream flags since the stream will be reused for other files
+  clear();
+
+  if (!_tempFileName.empty()) {
+    std::error_code errorCode;
+    std::filesystem::remove(_tempFileName, errorCode);
+    _tempFileName.clear();
+  }
+}
@@ -0,0 +1,273 @@
+// Corresponding header
+#include "resource_builder/CommandLineParser.h"
+
+// System headers
+#include <cctype>
+#include <cstdlib>
+#include <sstream>
+#include <string>
+
+// Other libraries headers
+#include "utils/log/Log.h"
+
+// Own components headers
+#include "resource_builder/LodBuilder.h"
+#include "resource_builder/TextureBudget.h"
+
+namespace {
+constexpr auto OPTION_PREFIX = "--";
+constexpr auto OPTION_PREFIX_SIZE = 2;
+constexpr auto OPTION_VALUE_DELIMITER = '=';
+constexpr int32_t DECIMAL_BASE = 10;
+constexpr int32_t HEX_BASE = 16;
+constexpr unsigned long MAX_CODEPOINT = 0x10FFFF;
+
+// printable ASCII
+constexpr CodepointRange DEFAULT_FONT_ATLAS_CHARSET { 32, 126 };
+
+/** @brief used to split "--name=value" into it's name and value parts.
+ *         Options without value produce an empty value string.
+ * */
+void splitOption(const std::string& arg, std::string& outName,
+                 std::string& outValue) {
+  const size_t delimiterPos = arg.find(OPTION_VALUE_DELIMITER);
+  if (std::string::npos == delimiterPos) {
+    outName = arg.substr(OPTION_PREFIX_SIZE);
+    outValue.clear();
+    return;
+  }
+
+  outName = arg.substr(OPTION_PREFIX_SIZE, delimiterPos - OPTION_PREFIX_SIZE);
+  outValue = arg.substr(delimiterPos + 1);
+}
+
+/** @brief used to parse a single decimal or "0x" prefixed hex codepoint
+ * */
+bool parseCodepoint(const std::string& text, uint32_t& outCodepoint) {
+  int32_t base = DECIMAL_BASE;
+  size_t pos = 0;
+  if ((2 < text.size()) && ('0' == text[0]) &&
+      (('x' == text[1]) || ('X' == text[1]))) {
+    base = HEX_BASE;
+    pos = 2;
+  }
+
+  if ((text.size() == pos) || !isalnum(static_cast<unsigned char>(text[pos]))) {
+    return false;
+  }
+
+  char* end = nullptr;
+  const unsigned long value = strtoul(text.c_str() + pos, &end, base);
+  if (('\0' != *end) || (MAX_CODEPOINT < value)) {
+    return false;
+  }
+
+  outCodepoint = static_cast<uint32_t>(value);
+  return true;
+}
+
+/** @brief used to parse comma separated codepoint ranges:
+ *              32-126,0xA0-0xFF,0x20AC
+ * */
+bool parseCodepointRanges(const std::string& text,
+                          std::vector<CodepointRange>& outRanges) {
+  outRanges.clear();
+
+  std::istringstream rangesStream(text);
+  std::string rangeStr;
+  while (std::getline(rangesStream, rangeStr, ',')) {
+    CodepointRange range;
+    const size_t delimiterPos = rangeStr.find('-');
+    if (std::string::npos == delimiterPos) {
+      if (!parseCodepoint(rangeStr, range.first)) {
+        return false;
+      }
+      range.last = range.first;
+    } else if (!parseCodepoint(rangeStr.substr(0, delimiterPos),
+                               range.first) ||
+               !parseCodepoint(rangeStr.substr(delimiterPos + 1),
+                               range.last) ||
+               (range.first > range.last)) {
+      return false;
+    }
+
+    outRanges.push_back(range);
+  }
+
+  return !outRanges.empty();
+}
+}
+
+ErrorCode CommandLineParser::parse(const int32_t argc, const char* args[],
+                                   ResourceBuilderConfig& outConfig) {
+  std::string optionName;
+  std::string optionValue;
+
+  for (int32_t i = 1; i < argc; ++i) {
+    const std::string arg = args[i];
+    if (0 != arg.rfind(OPTION_PREFIX, 0)) {
+      outConfig.projectNames.push_back(arg);
+      continue;
+    }
+
+    splitOption(arg, optionName, optionValue);
+
+    if ("fsync" == optionName) {
+      outConfig.syncOutputFiles = true;
+    } else if ("output-dir" == optionName) {
+      if (optionValue.empty()) {
+        LOGERR("Error, option: [%s] expects a directory", arg.c_str());
+        return ErrorCode::FAILURE;
+      }
+      outConfig.outputDir = optionValue;
+    } else if ("embed" == optionName) {
+      if (optionValue.empty() || ("incbin" == optionValue)) {
+        outConfig.embedMode = EmbedMode::INCBIN;
+      } else if ("c_array" == optionValue) {
+        outConfig.embedMode = EmbedMode::C_ARRAY;
+      } else {
+        LOGERR("Error, option: [%s] expects 'incbin' or 'c_array'",
+               arg.c_str());
+        return ErrorCode::FAILURE;
+      }
+    } else if ("access-trace" == optionName) {
+      if (optionValue.empty()) {
+        LOGERR("Error, option: [%s] expects a trace file", arg.c_str());
+        return ErrorCode::FAILURE;
+      }
+      outConfig.accessTraceFile = optionValue;
+    } else if ("verify-reproducible" == optionName) {
+      outConfig.verifyReproducible = true;
+    } else if ("compact-sprites" == optionName) {
+      outConfig.compactSprites = true;
+    } else if ("sound-bank" == optionName) {
+      outConfig.soundBank = true;
+    } else if ("sprite-uv" == optionName) {
+      if (optionValue.empty() || ("exact" == optionValue)) {
+        outConfig.spriteUvMode = SpriteUvMode::EXACT;
+      } else if ("half-texel" == optionValue) {
+        outConfig.spriteUvMode = SpriteUvMode::HALF_TEXEL_INSET;
+      } else {
+        LOGERR("Error, option: [%s] expects 'exact' or 'half-texel'",
+               arg.c_str());
+        return ErrorCode::FAILURE;
+      }
+    } else if ("font-atlas" == optionName) {
+      outConfig.fontAtlas = true;
+      if (optionValue.empty()) {
+        outConfig.fontAtlasCharset = { DEFAULT_FONT_ATLAS_CHARSET };
+      } else if (!parseCodepointRanges(optionValue,
+                                       outConfig.fontAtlasCharset)) {
+        LOGERR("Error, option: [%s] expects comma separated codepoint "
+               "ranges (e.g. 32-126,0xA0-0xFF)", arg.c_str());
+        return ErrorCode::FAILURE;
+      }
+    } else if ("trim-frames" == optionName) {
+      outConfig.trimFrames = true;
+    } else if ("dedupe-frames" == optionName) {
+      outConfig.dedupeFrames = true;
+    } else if ("lods" == optionName) {
+      if (!LodBuilder::parseScales(optionValue, outConfig.lodScales)) {
+        LOGERR("Error, option: [%s] expects comma separated scales in the "
+               "(0, 1] range (e.g. 1,0.5,0.25)", arg.c_str());
+        return ErrorCode::FAILURE;
+      }
+    } else if (("budget-entry" == optionName) ||
+               ("budget-rsrc" == optionName) ||
+               ("budget-on-init" == optionName) ||
+               ("budget-on-demand" == optionName)) {
+      TextureBudgets& budgets = outConfig.textureBudgets;
+      uint64_t& budget = ("budget-entry" == optionName) ? budgets.entry
+          : ("budget-rsrc" == optionName) ? budgets.resourceFile
+          : ("budget-on-init" == optionName) ? budgets.onInit
+          : budgets.onDemand;
+      if (!TextureBudget::parseSize(optionValue, budget)) {
+        LOGERR("Error, option: [%s] expects a size in bytes with an "
+               "optional K, M or G suffix (e.g. 64M)", arg.c_str());
+        return ErrorCode::FAILURE;
+      }
+    } else if ("budget-action" == optionName) {
+      if ("fail" == optionValue) {
+        outConfig.textureBudgets.action = BudgetAction::FAIL;
+      } else if ("warn" == optionValue) {
+        outConfig.textureBudgets.action = BudgetAction::WARN;
+      } else {
+        LOGERR("Error, option: [%s] expects 'fail' or 'warn'", arg.c_str());
+        return ErrorCode::FAILURE;
+      }
+    } else if ("lint" == optionName) {
+      outConfig.lint = true;
+    } else if ("verify-integrity" == optionName) {
+      outConfig.verifyIntegrity = true;
+    } else if ("texture-cache" == optionName) {
+      if (optionValue.empty() || ("straight" == optionValue)) {
+        outConfig.textureCacheMode = TextureCacheMode::STRAIGHT_ALPHA;
+      } else if ("premultiplied" == optionValue) {
+        outConfig.textureCacheMode = TextureCacheMode::PREMULTIPLIED_ALPHA;
+      } else {
+        LOGERR("Error, option: [%s] expects 'straight' or 'premultiplied'",
+               arg.c_str());
+        return ErrorCode::FAILURE;
+      }
+    } else {
+      LOGERR("Error, unknown option: [%s]", arg.c_str());
+      return ErrorCode::FAILURE;
+    }
+  }
+
+  if (outConfig.projectNames.empty()) {
+    LOGERR("Resource Builder tool expects a list a project folder names "
+           "within the root project folder to parse");
+    return ErrorCode::FAILURE;
+  }
+
+  return ErrorCode::SUCCESS;
+}
+
+void CommandLineParser::printUsage() {
+  LOG("Usage: resource_builder [options] <project_folder> [project_folder...]");
+  LOG("Options:");
+  LOG("  --fsync              flush every output file to disk before "
+      "publishing it");
+  LOG("  --output-dir=<dir>   write the auto-generated files into <dir> "
+      "(mirroring the project folder hierarchy) instead of the project "
+      "source tree");
+  LOG("  --embed[=<mode>]     generate files, which embed the assets into "
+      "the executable. Modes: 'incbin' (default, GCC/Clang) or 'c_array' "
+      "(any toolchain, e.g. MSVC or Emscripten)");
+  LOG("  --access-trace=<file> order the packed entries by the first-use "
+      "order of the resource hash values, recorded in <file>");
+  LOG("  --verify-reproducible build twice into temporary directories and "
+      "fail if the outputs are not byte-identical");
+  LOG("  --compact-sprites    write sprite sheets as grid descriptors "
+      "instead of per frame rectangles");
+  LOG("  --sprite-uv[=<mode>] write the normalized UV quad of every frame. "
+      "Modes: 'exact' (default) or 'half-texel' (half texel inset)");
+  LOG("  --sound-bank         pack all 'chunk' sounds of a project into "
+      "a single sounds.bank file");
+  LOG("  --font-atlas[=<ranges>] pre-rasterize the fonts into glyph atlases. "
+      "Ranges: comma separated codepoints (default 32-126)");
+  LOG("  --texture-cache[=<mode>] pre-decode the PNG images into raw RGBA8 "
+      "blobs. Modes: 'straight' (default) or 'premultiplied' alpha");
+  LOG("  --trim-frames        write the tight alpha bounds of every image "
+      "and sprite frame together with it's offset");
+  LOG("  --dedupe-frames      write a frame index remap table, which "
+      "collapses the pixel identical frames of every entry");
+  LOG("  --lods=<scales>      generate downscaled copies of the PNG images "
+      "without a 'lods' tag. Scales: comma separated, in the (0, 1] range "
+      "(e.g. 1,0.5,0.25)");
+  LOG("  --budget-entry=<size> decoded (RGBA8) texture memory budget of a "
+      "single image entry. Size: bytes with an optional K, M or G suffix");
+  LOG("  --budget-rsrc=<size> decoded texture memory budget of all image "
+      "entries in a single .rsrc file");
+  LOG("  --budget-on-init=<size> decoded texture memory budget of all "
+      "'on_init' image entries of a project");
+  LOG("  --budget-on-demand=<size> decoded texture memory budget of all "
+      "'on_demand' image entries of a project");
+  LOG("  --budget-action=<action> what happens when a budget is exceeded. "
+      "Actions: 'fail' (default) or 'warn'");
+  LOG("  --lint               log a ranked report of the images, which are "
+      "slow to load (progressive JPEG, interlaced or 16 bit PNG, ...)");
+  LOG("  --verify-integrity   fail the build on corrupted assets (PNG chunk "
+      "CRCs, JPEG end of image marker, Ogg page CRCs), checked in parallel");
+}
@@ -0,0 +1,317 @@
+// Corresponding header
+#include "resource_builder/EmbedFileBuilder.h"
+
+// System headers
+#include <algorithm>
+#include <filesystem>
+#include <fstream>
+#include <iomanip>
+#include <numeric>
+#include <system_error>
+
+// Other libraries headers
+#include "resource_utils/common/ResourceFileHeader.h"
+#include "utils/debug/StrError.h"
+#include "utils/log/Log.h"
+
+// Own components headers
+#include "resource_builder/BuilderStructs.h"
+
+namespace {
+constexpr auto TAB = "  "; // 2 spaces
+constexpr auto MAX_UINT64_T_HEX_LENGTH = 16;
+constexpr auto BYTES_PER_LINE = 16;
+constexpr auto READ_CHUNK_SIZE = 64 * 1024;
+
+void writeHex(std::ostream& stream, const uint64_t value) {
+  stream << "0x" << std::hex << std::uppercase
+         << std::setw(MAX_UINT64_T_HEX_LENGTH) << std::setfill('0') << value
+         << std::dec << std::nouppercase;
+}
+}
+
+EmbedFileBuilder::EmbedFileBuilder() : _mode(EmbedMode::NONE) {}
+
+void EmbedFileBuilder::init(const EmbedMode mode,
+                            const std::string& rootDirectory) {
+  _mode = mode;
+  _rootDirectory = rootDirectory;
+}
+
+void EmbedFileBuilder::setDestFileName(const std::string& destFileName) {
+  _indexFileName = destFileName;
+  _indexFileName.append("Embed.h");
+
+  _dataFileName = destFileName;
+  _dataFileName.append(
+      (EmbedMode::INCBIN == _mode) ? "Embed.S" : "Embed.cpp");
+
+  _indexFileNameNoDir =
+      std::filesystem::path(_indexFileName).filename().string();
+}
+
+void EmbedFileBuilder::setNamespace(const std::string& inputNamespace) {
+  _namespace = inputNamespace;
+  _namespace.append("Embed");
+}
+
+void EmbedFileBuilder::setHeaderGuards(const std::string& guards) {
+  _headerGuards = guards;
+  _headerGuards.append("EMBED");
+}
+
+ErrorCode EmbedFileBuilder::openDestStreams() {
+  if (ErrorCode::SUCCESS != _indexStream.begin(_indexFileName)) {
+    LOGERR("Error in _indexStream.begin()");
+    return ErrorCode::FAILURE;
+  }
+
+  if (ErrorCode::SUCCESS != _dataStream.begin(_dataFileName)) {
+    LOGERR("Error in _dataStream.begin()");
+    return ErrorCode::FAILURE;
+  }
+
+  return ErrorCode::SUCCESS;
+}
+
+ErrorCode EmbedFileBuilder::writeData(
+    const std::vector<BuilderCombinedData>& data) {
+  std::vector<uint64_t> sizes;
+  sizes.reserve(data.size());
+
+  for (const auto& entry : data) {
+    std::error_code errorCode;
+    const uint64_t size =
+        std::filesystem::file_size(entry.absoluteFilePath, errorCode);
+    if (errorCode) {
+      LOGERR("Error, could not obtain file size for: %s, reason: %s",
+             entry.absoluteFilePath.c_str(), errorCode.message().c_str());
+      return ErrorCode::FAILURE;
+    }
+    sizes.push_back(size);
+  }
+
+  writeIndexFile(data, sizes);
+
+  if (EmbedMode::INCBIN == _mode) {
+    return writeIncbinFile(data);
+  }
+
+  return writeByteArrayFile(data);
+}
+
+ErrorCode EmbedFileBuilder::publishDestStreams(const bool syncToDisk) {
+  if (ErrorCode::SUCCESS != _indexStream.publish(syncToDisk)) {
+    LOGERR("Error, could not publish: %s", _indexFileName.c_str());
+    return ErrorCode::FAILURE;
+  }
+
+  if (ErrorCode::SUCCESS != _dataStream.publish(syncToDisk)) {
+    LOGERR("Error, could not publish: %s", _dataFileName.c_str());
+    return ErrorCode::FAILURE;
+  }
+
+  return ErrorCode::SUCCESS;
+}
+
+void EmbedFileBuilder::closeDestStreams() {
+  _indexStream.discard();
+  _dataStream.discard();
+}
+
+void EmbedFileBuilder::writeIndexFile(
+    const std::vector<BuilderCombinedData>& data,
+    const std::vector<uint64_t>& sizes) {
+  // the index is sorted by hash value so it can be binary searched
+  std::vector<size_t> order(data.size());
+  std::iota(order.begin(), order.end(), 0);
+  std::sort(order.begin(), order.end(), [&data](size_t lhs, size_t rhs) {
+    return data[lhs].header.hashValue < data[rhs].header.hashValue;
+  });
+
+  _indexStream << ResourceFileHeader::getResourceFileHeader() << "#ifndef "
+               << _headerGuards << '\n'
+               << "#define " << _headerGuards << "\n\n"
+               << "#include <cstdint>\n\n"
+               << "extern \"C\"\n{\n";
+
+  for (size_t i = 0; i < data.size(); ++i) {
+    _indexStream << TAB << "extern const unsigned char " << getSymbolName(i)
+                 << "[];\n";
+  }
+
+  _indexStream << "}\n\n"
+               << "namespace " << _namespace << "\n{\n"
+               << TAB << "struct EmbeddedResource\n"
+               << TAB << "{\n"
+               << TAB << TAB << "uint64_t hashValue;\n"
+               << TAB << TAB << "const unsigned char* data;\n"
+               << TAB << TAB << "uint64_t size;\n"
+               << TAB << "};\n\n"
+               << TAB << "/* sorted by hashValue */\n"
+               << TAB << "inline constexpr EmbeddedResource "
+               << "EMBEDDED_RESOURCES[] =\n"
+               << TAB << "{\n";
+
+  for (const size_t idx : order) {
+    _indexStream << TAB << TAB << "{ ";
+    writeHex(_indexStream, data[idx].header.hashValue);
+    _indexStream << ", " << getSymbolName(idx) << ", " << sizes[idx]
+                 << " }, /* " << data[idx].tagName << " */\n";
+  }
+
+  // zero sized arrays are not allowed. The entry is never looked up
+  if (data.empty()) {
+    _indexStream << TAB << TAB << "{ 0, nullptr, 0 }\n";
+  }
+
+  _indexStream
+      << TAB << "};\n\n"
+      << TAB << "inline constexpr uint64_t EMBEDDED_RESOURCES_COUNT = "
+      << data.size() << ";\n\n"
+      << TAB << "/* returns nullptr if the provided hash value "
+      << "is not embedded */\n"
+      << TAB << "constexpr const EmbeddedResource* "
+      << "findEmbeddedResource(const uint64_t hashValue)\n"
+      << TAB << "{\n"
+      << TAB << TAB << "uint64_t first = 0;\n"
+      << TAB << TAB << "uint64_t last = EMBEDDED_RESOURCES_COUNT;\n"
+      << TAB << TAB << "while (first < last)\n"
+      << TAB << TAB << "{\n"
+      << TAB << TAB << TAB << "const uint64_t mid = first + (last - first) "
+      << "/ 2;\n"
+      << TAB << TAB << TAB << "if (EMBEDDED_RESOURCES[mid].hashValue < "
+      << "hashValue)\n"
+      << TAB << TAB << TAB << "{\n"
+      << TAB << TAB << TAB << TAB << "first = mid + 1;\n"
+      << TAB << TAB << TAB << "}\n"
+      << TAB << TAB << TAB << "else\n"
+      << TAB << TAB << TAB << "{\n"
+      << TAB << TAB << TAB << TAB << "last = mid;\n"
+      << TAB << TAB << TAB << "}\n"
+      << TAB << TAB << "}\n\n"
+      << TAB << TAB << "if ((first < EMBEDDED_RESOURCES_COUNT) &&\n"
+      << TAB << TAB << TAB << "(EMBEDDED_RESOURCES[first].hashValue == "
+      << "hashValue))\n"
+      << TAB << TAB << "{\n"
+      << TAB << TAB << TAB << "return &EMBEDDED_RESOURCES[first];\n"
+      << TAB << TAB << "}\n\n"
+      << TAB << TAB << "return nullptr;\n"
+      << TAB << "}\n"
+      << "} /* namespace " << _namespace << " */\n\n"
+      << "#endif /* " << _headerGuards << " */";
+}
+
+ErrorCode EmbedFileBuilder::writeIncbinFile(
+    const std::vector<BuilderCombinedData>& data) {
+  // .S files are preprocessed, so the C-style header comment is valid
+  _dataStream << ResourceFileHeader::getResourceFileHeader()
+              << "#if defined(__APPLE__)\n"
+              << "  #define EMBED_SYMBOL(name) _##name\n"
+              << "  .const\n"
+              << "#else\n"
+              << "  #define EMBED_SYMBOL(name) name\n"
+              << "  .section .rodata\n"
+              << "#endif\n\n";
+
+  std::string relativePath;
+  for (size_t i = 0; i < data.size(); ++i) {
+    if (ErrorCode::SUCCESS != getRootRelativePath(data[i].absoluteFilePath,
+                                                  relativePath)) {
+      LOGERR("Error in getRootRelativePath() for: %s",
+             data[i].absoluteFilePath.c_str());
+      return ErrorCode::FAILURE;
+    }
+
+    const std::string symbol = getSymbolName(i);
+    _dataStream << "/* " << data[i].tagName << " */\n"
+                << TAB << ".global EMBED_SYMBOL(" << symbol << ")\n"
+                << TAB << ".balign 16\n"
+                << "EMBED_SYMBOL(" << symbol << "):\n"
+                << TAB << ".incbin \"" << relativePath << "\"\n\n";
+  }
+
+  // mark the stack as non-executable for the ELF targets
+  _dataStream << "#if defined(__ELF__)\n"
+              << "  .section .note.GNU-stack,\"\",%progbits\n"
+              << "#endif\n";
+
+  return ErrorCode::SUCCESS;
+}
+
+ErrorCode EmbedFileBuilder::writeByteArrayFile(
+    const std::vector<BuilderCombinedData>& data) {
+  _dataStream << ResourceFileHeader::getResourceFileHeader()
+              << "#include \"" << _indexFileNameNoDir << "\"\n\n"
+              << "extern \"C\"\n{\n";
+
+  std::vector<char> buffer(READ_CHUNK_SIZE);
+  _dataStream << std::hex << std::uppercase << std::setfill('0');
+
+  for (size_t i = 0; i < data.size(); ++i) {
+    std::ifstream assetStream(data[i].absoluteFilePath.c_str(),
+                              std::ifstream::in | std::ifstream::binary);
+    if (!assetStream) {
+      LOGERR("Error, could not open ifstream for fileName: %s, reason: %s",
+             data[i].absoluteFilePath.c_str(), strError().c_str());
+      return ErrorCode::FAILURE;
+    }
+
+    _dataStream << "/* " << data[i].tagName << " */\n"
+                << "alignas(16) extern const unsigned char "
+                << getSymbolName(i) << "[] =\n{\n";
+
+    uint64_t bytesWritten = 0;
+    while (assetStream) {
+      assetStream.read(buffer.data(), READ_CHUNK_SIZE);
+      const std::streamsize bytesRead = assetStream.gcount();
+
+      for (std::streamsize j = 0; j < bytesRead; ++j) {
+        if (0 == (bytesWritten % BYTES_PER_LINE)) {
+          _dataStream << TAB;
+        }
+
+        _dataStream << "0x" << std::setw(2)
+                    << static_cast<uint32_t>(
+                        static_cast<unsigned char>(buffer[j])) << ',';
+        ++bytesWritten;
+
+        _dataStream << ((0 == (bytesWritten % BYTES_PER_LINE)) ? '\n' : ' ');
+      }
+    }
+
+    // zero sized arrays are not allowed. The size in the index remains 0
+    if (0 == bytesWritten) {
+      _dataStream << TAB << "0x00";
+    }
+
+    _dataStream << "\n};\n\n";
+  }
+
+  _dataStream << std::dec << std::nouppercase << std::setfill(' ')
+              << "} /* extern \"C\" */\n";
+
+  return ErrorCode::SUCCESS;
+}
+
+std::string EmbedFileBuilder::getSymbolName(const size_t idx) const {
+  std::string symbol = _namespace;
+  symbol.append("_").append(std::to_string(idx));
+  return symbol;
+}
+
+ErrorCode EmbedFileBuilder::getRootRelativePath(
+    const std::string& absolutePath, std::string& outPath) const {
+  const std::filesystem::path relativePath =
+      std::filesystem::path(absolutePath).lexically_relative(_rootDirectory);
+  if (relativePath.empty()) {
+    LOGERR("Error, asset: %s can not be reached relatively from the root "
+           "project folder: %s", absolutePath.c_str(),
+           _rootDirectory.c_str());
+    return ErrorCode::FAILURE;
+  }
+
+  outPath = relativePath.generic_string();
+  std::replace(outPath.begin(), outPath.end(), '\\', '/');
+  return ErrorCode::SUCCESS;
+}
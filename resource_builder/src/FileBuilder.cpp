@@ -2,38 +2,189 @@
 #include "resource_builder/FileBuilder.h"
 
 // System headers
+#include <algorithm>
+#include <cinttypes>
+#include <filesystem>
 #include <sstream>
 #include <iomanip>
+#include <system_error>
 
 // Other libraries headers
 #include "resource_utils/defines/ResourceDefines.h"
 #include "resource_utils/common/ResourceFileHeader.h"
-#include "resource_utils/structs/CombinedStructs.h"
-#include "utils/debug/StrError.h"
 #include "utils/ErrorCode.h"
 #include "utils/log/Log.h"
 
 // Own components headers
+#include "resource_builder/BuilderStructs.h"
+#include "resource_builder/ResourceBuilderConfig.h"
+#include "resource_builder/SpriteGrid.h"
 
 namespace {
 constexpr auto MB_PRECISION_AFTER_DECIMAL = 3;
+constexpr double BYTES_PER_MB = 1024.0 * 1024.0;
 constexpr auto TAB = "  "; // 2 spaces
 constexpr auto DATA_TYPE = "uint64_t";
 constexpr auto MAX_UINT64_T_HEX_LENGTH = 16;
+constexpr auto LOAD_GROUPS_FOLDER_NAME = "groups";
+constexpr auto LOAD_GROUP_FILE_EXTENSION = ".bin";
+constexpr auto INDICES_FILE_NAME = "ResourceIndices.h";
+constexpr auto SOUND_BANK_FILE_NAME = "sounds.bank";
+constexpr auto INDICES_NAMESPACE = "ResourceIndices";
+constexpr auto INDEX_DATA_TYPE = "uint32_t";
+constexpr auto UV_FLOATS_PER_FRAME = 4;
+constexpr auto FLOAT_ROUND_TRIP_DIGITS = 9;
+constexpr auto DEFAULT_STREAM_PRECISION = 6;
+
+void writeHex(std::ostream& stream, const uint64_t value) {
+  stream << "0x" << std::hex << std::uppercase
+         << std::setw(MAX_UINT64_T_HEX_LENGTH) << std::setfill('0') << value
+         << std::dec << std::nouppercase;
 }
 
-FileBuilder::~FileBuilder() noexcept { closeCombinedStreams(); }
+/** @brief used to write the content digest of the asset file as
+ *         a single line:
+ *              digest <0x16 hex digits>
+ * */
+void writeDigest(std::ostream& stream, const uint64_t digest) {
+  stream << "digest ";
+  writeHex(stream, digest);
+  stream << '\n';
+}
+
+bool isWidget(const BuilderCombinedData& entry) {
+  return ("font" != entry.type) && ("sound" != entry.type);
+}
+
+const char* getContainerName(const TextureContainer container) {
+  switch (container) {
+    case TextureContainer::KTX2:
+      return "ktx2";
+    case TextureContainer::DDS:
+      return "dds";
+    case TextureContainer::ASTC:
+      return "astc";
+    default:
+      return "none";
+  }
+}
+
+/** @brief used to write the trimmed rectangle and the offset inside
+ *         the original frame of every frame as a single line:
+ *              trim <count> <x y w h offsetX offsetY of frame 0> ...
+ * */
+void writeFrameTrims(std::ostream& stream,
+                     const std::vector<FrameTrim>& frameTrims) {
+  stream << "trim " << frameTrims.size();
+  for (const FrameTrim& trim : frameTrims) {
+    stream << ' ' << trim.rect.x << ' ' << trim.rect.y << ' ' << trim.rect.w
+           << ' ' << trim.rect.h << ' ' << trim.offsetX << ' '
+           << trim.offsetY;
+  }
+  stream << '\n';
+}
+
+/** @brief used to write the scaled rectangles of a downscaled image copy
+ *         as a single line:
+ *              lod <scale> <file> <x y w h> <count> <x y w h of frame 0> ...
+ * */
+void writeTextureLod(std::ostream& stream, const TextureLod& lod) {
+  stream << "lod " << lod.scale << ' ' << lod.fileName << ' '
+         << lod.imageRect.x << ' ' << lod.imageRect.y << ' '
+         << lod.imageRect.w << ' ' << lod.imageRect.h << ' '
+         << lod.spriteData.size();
+  for (const auto& sprite : lod.spriteData) {
+    stream << ' ' << sprite.x << ' ' << sprite.y << ' ' << sprite.w << ' '
+           << sprite.h;
+  }
+  stream << '\n';
+}
+
+/** @brief used to write the normalized u0 v0 u1 v1 quad of every frame
+ *         as a single contiguous float array line:
+ *              uv <floatsCount> <u0 v0 u1 v1 of frame 0> ... <of frame N>
+ * */
+void writeSpriteUvs(std::ostream& stream, const BuilderCombinedData& entry,
+                    const SpriteUvMode mode) {
+  const double textureWidth = static_cast<double>(entry.imageRect.w);
+  const double textureHeight = static_cast<double>(entry.imageRect.h);
+
+  // texture dimensions are unknown - UVs can not be normalized
+  if ((0 >= entry.imageRect.w) || (0 >= entry.imageRect.h)) {
+    stream << "uv 0\n";
+    return;
+  }
+
+  // keep bilinear filtering from sampling the neighbouring frames
+  const double inset = (SpriteUvMode::HALF_TEXEL_INSET == mode) ? 0.5 : 0.0;
+
+  stream << "uv " << (entry.spriteData.size() * UV_FLOATS_PER_FRAME)
+         << std::setprecision(FLOAT_ROUND_TRIP_DIGITS);
+
+  for (const auto& sprite : entry.spriteData) {
+    const float uvs[UV_FLOATS_PER_FRAME] = {
+        static_cast<float>((sprite.x + inset) / textureWidth),
+        static_cast<float>((sprite.y + inset) / textureHeight),
+        static_cast<float>((sprite.x + sprite.w - inset) / textureWidth),
+        static_cast<float>((sprite.y + sprite.h - inset) / textureHeight) };
+
+    for (const float uv : uvs) {
+      stream << ' ' << uv;
+    }
+  }
+
+  stream << std::setprecision(DEFAULT_STREAM_PRECISION) << '\n';
+}
+}
+
+FileBuilder::FileBuilder()
+    : _syncOutputFiles(false), _compactSprites(false),
+      _spriteUvMode(SpriteUvMode::NONE), _soundBankEnabled(false),
+      _fontAtlasEnabled(false), _textureCacheEnabled(false),
+      _lintEnabled(false), _integrityCheckEnabled(false) {}
+
+FileBuilder::~FileBuilder() noexcept {
+  closeCombinedStreams();
+  closeDestStream();
+}
+
+ErrorCode FileBuilder::init(const ResourceBuilderConfig& config,
+                            const std::string& rootDirectory) {
+  _syncOutputFiles = config.syncOutputFiles;
+  _compactSprites = config.compactSprites;
+  _spriteUvMode = config.spriteUvMode;
+  _soundBankEnabled = config.soundBank;
+  _fontAtlasEnabled = config.fontAtlas;
+  _glyphAtlasBuilder.init(config.fontAtlasCharset);
+  _textureCacheEnabled = (TextureCacheMode::NONE != config.textureCacheMode);
+  _textureCacheBuilder.init(config.textureCacheMode);
+  _lodBuilder.init(config.lodScales);
+  _imageAnalyzer.init(config);
+  _lintEnabled = config.lint;
+  _integrityCheckEnabled = config.verifyIntegrity;
+  _assetLinter.init(config);
+  _embedFileBuilder.init(config.embedMode, rootDirectory);
+
+  if (!config.accessTraceFile.empty() &&
+      (ErrorCode::SUCCESS != _accessTrace.load(config.accessTraceFile))) {
+    LOGERR("Error in _accessTrace.load()");
+    return ErrorCode::FAILURE;
+  }
+
+  return ErrorCode::SUCCESS;
+}
+
+void FileBuilder::setCombinedHeaderGuards(const std::string& guards) {
+  _headerGuardsIndices = guards;
+}
 
 ErrorCode FileBuilder::openCombinedStreams(const std::string& resFileName,
                                            const std::string& fontFileName,
                                            const std::string& soundFileName) {
-  // open fileStream for write
-  _combinedResDestStream.open(resFileName.c_str(),
-                              std::ofstream::out | std::ofstream::binary);
+  _combinedDestDir = std::filesystem::path(resFileName).parent_path().string();
 
-  if (!_combinedResDestStream) {
-    LOGERR("Error, could not open ofstream for fileName: %s, reason: %s",
-        resFileName.c_str(), strError().c_str());
+  if (ErrorCode::SUCCESS != _combinedResDestStream.begin(resFileName)) {
+    LOGERR("Error in _combinedResDestStream.begin()");
     return ErrorCode::FAILURE;
   }
 
@@ -47,13 +198,8 @@ ErrorCode FileBuilder::openCombinedStreams(const std::string& resFileName,
                          << ResourceFileHeader::getEngineValueReservedSlot()
                          << "\n\n";
 
-  // open fileStream for write
-  _combinedFontDestStream.open(fontFileName.c_str(),
-                               std::ofstream::out | std::ofstream::binary);
-
-  if (!_combinedFontDestStream) {
-    LOGERR("Error, could not open ofstream for fileName: %s, reason: %s",
-           fontFileName.c_str(), strError().c_str());
+  if (ErrorCode::SUCCESS != _combinedFontDestStream.begin(fontFileName)) {
+    LOGERR("Error in _combinedFontDestStream.begin()");
     return ErrorCode::FAILURE;
   }
 
@@ -63,13 +209,8 @@ ErrorCode FileBuilder::openCombinedStreams(const std::string& resFileName,
       << ResourceFileHeader::getEngineFileSizeHeader()
       << ResourceFileHeader::getEngineValueReservedSlot() << "\n\n";
 
-  // open fileStream for write
-  _combinedSoundDestStream.open(soundFileName.c_str(),
-                                std::ofstream::out | std::ofstream::binary);
-
-  if (!_combinedSoundDestStream) {
-    LOGERR("Error, could not open ofstream for fileName: %s, reason: %s",
-           soundFileName.c_str(), strError().c_str());
+  if (ErrorCode::SUCCESS != _combinedSoundDestStream.begin(soundFileName)) {
+    LOGERR("Error in _combinedSoundDestStream.begin()");
     return ErrorCode::FAILURE;
   }
 
@@ -81,57 +222,81 @@ ErrorCode FileBuilder::openCombinedStreams(const std::string& resFileName,
       << ResourceFileHeader::getEngineFileSizeHeader()
       << ResourceFileHeader::getEngineValueReservedSlot() << "\n\n";
 
+  const std::string indicesFileName =
+      (std::filesystem::path(_combinedDestDir) / INDICES_FILE_NAME).string();
+  if (ErrorCode::SUCCESS !=
+      _combinedIndicesDestStream.begin(indicesFileName)) {
+    LOGERR("Error in _combinedIndicesDestStream.begin()");
+    return ErrorCode::FAILURE;
+  }
+
+  if (_soundBankEnabled) {
+    const std::string bankFileName =
+        (std::filesystem::path(_combinedDestDir) / SOUND_BANK_FILE_NAME)
+            .string();
+    if (ErrorCode::SUCCESS != _soundBankBuilder.openBankStream(bankFileName)) {
+      LOGERR("Error in _soundBankBuilder.openBankStream()");
+      return ErrorCode::FAILURE;
+    }
+  }
+
   return ErrorCode::SUCCESS;
 }
 
 void FileBuilder::closeCombinedStreams() {
-  // close the stream
-  _combinedResDestStream.close();
-
-  // reset stream flags since we will be reusing it for other files
-  _combinedResDestStream.clear();
-
-  // close the stream
-  _combinedFontDestStream.close();
-
-  // reset stream flags since we will be reusing it for other files
-  _combinedFontDestStream.clear();
-
-  // close the stream
-  _combinedSoundDestStream.close();
-
-  // reset stream flags since we will be reusing it for other files
-  _combinedSoundDestStream.clear();
+  // unpublished (incomplete) combined files are thrown away
+  _combinedResDestStream.discard();
+  _combinedFontDestStream.discard();
+  _combinedSoundDestStream.discard();
+  _combinedIndicesDestStream.discard();
+  _soundBankBuilder.closeBankStream();
+  _glyphAtlasBuilder.reset();
+  _textureCacheBuilder.reset();
+  _lodBuilder.reset();
+
+  _combinedData.clear();
 }
 
 ErrorCode FileBuilder::openDestStreams() {
-  // open _destStreamStatic for write
-  _destStreamStatic.open(_destFileNameStatic.c_str(),
-                         std::ofstream::out | std::ofstream::binary);
+  if (ErrorCode::SUCCESS != _destStreamStatic.begin(_destFileNameStatic)) {
+    LOGERR("Error in _destStreamStatic.begin()");
+    return ErrorCode::FAILURE;
+  }
 
-  if (!_destStreamStatic) {
-    LOGERR("Error, could not open ofstream for fileName: %s, reason: %s",
-           _destFileNameStatic.c_str(), strError().c_str());
+  if (ErrorCode::SUCCESS != _destStreamDynamic.begin(_destFileNameDynamic)) {
+    LOGERR("Error in _destStreamDynamic.begin()");
     return ErrorCode::FAILURE;
   }
 
-  // open _destStreamDynamic for write
-  _destStreamDynamic.open(_destFileNameDynamic.c_str(),
-                          std::ofstream::out | std::ofstream::binary);
+  if (ErrorCode::SUCCESS !=
+      _destStreamDynamicValues.begin(_destFileNameDynamicValues)) {
+    LOGERR("Error in _destStreamDynamicValues.begin()");
+    return ErrorCode::FAILURE;
+  }
 
-  if (!_destStreamDynamic) {
-    LOGERR("Error, could not open ofstream for fileName: %s, reason: %s",
-           _destFileNameDynamic.c_str(), strError().c_str());
+  if (_embedFileBuilder.isEnabled() &&
+      (ErrorCode::SUCCESS != _embedFileBuilder.openDestStreams())) {
+    LOGERR("Error in _embedFileBuilder.openDestStreams()");
     return ErrorCode::FAILURE;
   }
 
-  // open _destStreamDynamicValues for write
-  _destStreamDynamicValues.open(_destFileNameDynamicValues.c_str(),
-                                std::ofstream::out | std::ofstream::binary);
+  return ErrorCode::SUCCESS;
+}
+
+ErrorCode FileBuilder::publishDestStreams() {
+  AtomicFileStream* streams[] = {
+      &_destStreamStatic, &_destStreamDynamic, &_destStreamDynamicValues };
+
+  for (AtomicFileStream* stream : streams) {
+    if (ErrorCode::SUCCESS != stream->publish(_syncOutputFiles)) {
+      LOGERR("Error, could not publish: %s", stream->getFileName().c_str());
+      return ErrorCode::FAILURE;
+    }
+  }
 
-  if (!_destStreamDynamicValues) {
-    LOGERR("Error, could not open ofstream for fileName: %s, reason: %s",
-           _destFileNameDynamicValues.c_str(), strError().c_str());
+  if (_embedFileBuilder.isEnabled() && (ErrorCode::SUCCESS !=
+      _embedFileBuilder.publishDestStreams(_syncOutputFiles))) {
+    LOGERR("Error in _embedFileBuilder.publishDestStreams()");
     return ErrorCode::FAILURE;
   }
 
@@ -139,15 +304,11 @@ ErrorCode FileBuilder::openDestStreams() {
 }
 
 void FileBuilder::closeDestStream() {
-  // close the header stream
-  _destStreamStatic.close();
-  _destStreamDynamic.close();
-  _destStreamDynamicValues.close();
-
-  // reset stream flags since we will be reusing it for other files
-  _destStreamStatic.clear();
-  _destStreamDynamic.clear();
-  _destStreamDynamicValues.clear();
+  // unpublished (incomplete) files are thrown away
+  _destStreamStatic.discard();
+  _destStreamDynamic.discard();
+  _destStreamDynamicValues.discard();
+  _embedFileBuilder.closeDestStreams();
 }
 
 void FileBuilder::setNamespace(const std::string& inputNamespace) {
@@ -155,6 +316,8 @@ void FileBuilder::setNamespace(const std::string& inputNamespace) {
 
   _namespaceDynamic = inputNamespace;
   _namespaceDynamic.append("Dynamic");
+
+  _embedFileBuilder.setNamespace(inputNamespace);
 }
 
 void FileBuilder::setDestFileName(const std::string& destFileName) {
@@ -166,6 +329,8 @@ void FileBuilder::setDestFileName(const std::string& destFileName) {
 
   _destFileNameDynamicValues = destFileName;
   _destFileNameDynamicValues.append("DynamicValues.h");
+
+  _embedFileBuilder.setDestFileName(destFileName);
 }
 
 void FileBuilder::setHeaderGuards(const std::string& guards) {
@@ -173,19 +338,117 @@ void FileBuilder::setHeaderGuards(const std::string& guards) {
 
   _headerGuardsDynamic = guards;
   _headerGuardsDynamic.append("DYNAMIC");
-}
 
-void FileBuilder::writeData(const std::vector<CombinedData>& data) {
-  fillCombinedDestFile(data);
+  _embedFileBuilder.setHeaderGuards(guards);
+}
 
+ErrorCode FileBuilder::writeData(
+    const std::vector<BuilderCombinedData>& data) {
   autoGenerateResFile(data);
+
+  // the packed outputs follow the first-use order of the access trace
+  std::vector<BuilderCombinedData> orderedData = data;
+  _accessTrace.sortEntries(orderedData);
+
+  for (auto& entry : orderedData) {
+    entry.resourceNamespace =
+        (ResourceDefines::TextureLoadType::ON_INIT == entry.textureLoadType)
+            ? _namespaceStatic
+            : _namespaceDynamic;
+  }
+
+  if (_embedFileBuilder.isEnabled() &&
+      (ErrorCode::SUCCESS != _embedFileBuilder.writeData(orderedData))) {
+    LOGERR("Error in _embedFileBuilder.writeData()");
+    return ErrorCode::FAILURE;
+  }
+
+  _combinedData.insert(_combinedData.end(), orderedData.begin(),
+                       orderedData.end());
+
+  return ErrorCode::SUCCESS;
 }
 
-void FileBuilder::finishCombinedDestFiles(
+ErrorCode FileBuilder::finishCombinedDestFiles(
     const uint64_t staticWidgetsCount, const uint64_t dynamicWidgetsCount,
     const uint64_t fontsCount, const uint64_t musicsCount,
-    const uint64_t chunksCount, const int32_t totalWidgetFileSize,
-    const int32_t totalFontsFileSize, const int32_t totalSoundsFileSize) {
+    const uint64_t chunksCount, const uint64_t totalWidgetFileSize,
+    const uint64_t totalFontsFileSize, const uint64_t totalSoundsFileSize) {
+  // the totals are written over the fixed width reserved header slots
+  const size_t reservedSlotSize =
+      ResourceFileHeader::getEngineValueReservedSlot().size();
+  for (const uint64_t totalSize : { totalWidgetFileSize, totalFontsFileSize,
+                                    totalSoundsFileSize }) {
+    if (reservedSlotSize < std::to_string(totalSize).size()) {
+      LOGERR("Error, total file size: %" PRIu64 " bytes does not fit in "
+             "the %zu characters reserved header slot", totalSize,
+             reservedSlotSize);
+      closeCombinedStreams();
+      return ErrorCode::FAILURE;
+    }
+  }
+
+  // entries are ordered across the .rsrc file boundaries
+  _accessTrace.sortEntries(_combinedData);
+
+  if (_lintEnabled) {
+    _assetLinter.lint(_combinedData);
+  }
+
+  // corrupted assets must not reach the published files
+  if (_integrityCheckEnabled &&
+      (ErrorCode::SUCCESS != _integrityVerifier.verify(_combinedData))) {
+    LOGERR("Error in _integrityVerifier.verify()");
+    closeCombinedStreams();
+    return ErrorCode::FAILURE;
+  }
+
+  // the analysis results are written to the combined resource file
+  if (_imageAnalyzer.isEnabled() &&
+      (ErrorCode::SUCCESS != _imageAnalyzer.analyze(_combinedData))) {
+    LOGERR("Error in _imageAnalyzer.analyze()");
+    closeCombinedStreams();
+    return ErrorCode::FAILURE;
+  }
+
+  // the bank offsets are referenced from the combined sound file
+  if (_soundBankEnabled &&
+      (ErrorCode::SUCCESS != _soundBankBuilder.writeData(_combinedData))) {
+    LOGERR("Error in _soundBankBuilder.writeData()");
+    closeCombinedStreams();
+    return ErrorCode::FAILURE;
+  }
+
+  // the atlases are referenced from the combined font file
+  if (_fontAtlasEnabled &&
+      (ErrorCode::SUCCESS != _glyphAtlasBuilder.writeData(
+          _combinedDestDir, _combinedData, _syncOutputFiles))) {
+    LOGERR("Error in _glyphAtlasBuilder.writeData()");
+    closeCombinedStreams();
+    return ErrorCode::FAILURE;
+  }
+
+  // the blobs are referenced from the combined resource file
+  if (_textureCacheEnabled &&
+      (ErrorCode::SUCCESS != _textureCacheBuilder.writeData(
+          _combinedDestDir, _combinedData, _syncOutputFiles))) {
+    LOGERR("Error in _textureCacheBuilder.writeData()");
+    closeCombinedStreams();
+    return ErrorCode::FAILURE;
+  }
+
+  // the LODs are referenced from the combined resource file. The entries
+  // may request LODs on their own, so the builder is always run
+  if (ErrorCode::SUCCESS != _lodBuilder.writeData(
+          _combinedDestDir, _combinedData, _syncOutputFiles)) {
+    LOGERR("Error in _lodBuilder.writeData()");
+    closeCombinedStreams();
+    return ErrorCode::FAILURE;
+  }
+
+  fillCombinedDestFile(_combinedData);
+  fillCombinedIndicesFile(_combinedData);
+
   finishCombinedResFile(staticWidgetsCount, dynamicWidgetsCount,
                         totalWidgetFileSize);
 
@@ -193,10 +456,55 @@ void FileBuilder::finishCombinedDestFiles(
 
   finishCombinedSoundFile(musicsCount, chunksCount, totalSoundsFileSize);
 
+  // the bank is published before the combined sound file, which references
+  // it's offsets - like the atlases, the blobs and the LODs
+  if (_soundBankEnabled && (ErrorCode::SUCCESS !=
+          _soundBankBuilder.publishBankStream(_syncOutputFiles))) {
+    LOGERR("Error in _soundBankBuilder.publishBankStream()");
+    closeCombinedStreams();
+    return ErrorCode::FAILURE;
+  }
+
+  auto err = ErrorCode::SUCCESS;
+  AtomicFileStream* streams[] = { &_combinedResDestStream,
+      &_combinedFontDestStream, &_combinedSoundDestStream,
+      &_combinedIndicesDestStream };
+
+  for (AtomicFileStream* stream : streams) {
+    if (ErrorCode::SUCCESS != stream->publish(_syncOutputFiles)) {
+      LOGERR("Error, could not publish: %s", stream->getFileName().c_str());
+      err = ErrorCode::FAILURE;
+      break;
+    }
+  }
+
+  if ((ErrorCode::SUCCESS == err) &&
+      (ErrorCode::SUCCESS != finishLoadGroupFiles())) {
+    LOGERR("Error in finishLoadGroupFiles()");
+    err = ErrorCode::FAILURE;
+  }
+
+  // atlases, blobs and LODs are removed only after the combined files
+  // stop referencing them
+  if ((ErrorCode::SUCCESS == err) && _fontAtlasEnabled) {
+    _glyphAtlasBuilder.removeStaleAtlases(_combinedDestDir);
+  }
+
+  if ((ErrorCode::SUCCESS == err) && _textureCacheEnabled) {
+    _textureCacheBuilder.removeStaleBlobs(_combinedDestDir);
+  }
+
+  if (ErrorCode::SUCCESS == err) {
+    _lodBuilder.removeStaleLods(_combinedDestDir);
+  }
+
   closeCombinedStreams();
+
+  return err;
 }
 
-void FileBuilder::fillCombinedDestFile(const std::vector<CombinedData>& data) {
+void FileBuilder::fillCombinedDestFile(
+    const std::vector<BuilderCombinedData>& data) {
   for (const auto& entry : data) {
     if ("font" == entry.type) {
       _combinedFontDestStream << std::hex << std::uppercase;
@@ -207,8 +515,22 @@ void FileBuilder::fillCombinedDestFile(const std::vector<CombinedData>& data) {
       _combinedFontDestStream << std::dec << std::nouppercase;
 
       _combinedFontDestStream << entry.header.path << '\n'
-                              << entry.header.fileSize << '\n'
-                              << entry.fontSize << "\n\n";
+                              << entry.fileSize << '\n'
+                              << entry.fontSize << '\n';
+      writeDigest(_combinedFontDestStream, entry.contentDigest);
+      _combinedFontDestStream
+          << "metrics " << entry.fontInfo.unitsPerEm << ' '
+          << entry.fontInfo.ascent << ' ' << entry.fontInfo.descent << ' '
+          << entry.fontInfo.lineGap << ' ' << entry.fontInfo.glyphCount << '\n'
+          << "atlas " << entry.fontInfo.atlasWidth << ' '
+          << entry.fontInfo.atlasHeight << '\n';
+
+      std::string atlasName;
+      if (_glyphAtlasBuilder.getAtlasName(entry.header.hashValue,
+                                          atlasName)) {
+        _combinedFontDestStream << "glyph_atlas " << atlasName << '\n';
+      }
+      _combinedFontDestStream << '\n';
     } else if ("sound" == entry.type) {
       _combinedSoundDestStream << std::hex << std::uppercase;
       _combinedSoundDestStream << "0x" << std::setw(MAX_UINT64_T_HEX_LENGTH)
@@ -218,9 +540,21 @@ void FileBuilder::fillCombinedDestFile(const std::vector<CombinedData>& data) {
       _combinedSoundDestStream << std::dec << std::nouppercase;
 
       _combinedSoundDestStream << entry.header.path << '\n'
-                               << entry.header.fileSize << '\n'
+                               << entry.fileSize << '\n'
                                << entry.soundType << '\n'
-                               << entry.soundLevel << "\n\n";
+                               << entry.soundLevel << '\n';
+      writeDigest(_combinedSoundDestStream, entry.contentDigest);
+      _combinedSoundDestStream << "format " << entry.soundInfo.sampleRate
+                               << ' ' << entry.soundInfo.channels << ' '
+                               << entry.soundInfo.bitsPerSample << ' '
+                               << entry.soundInfo.totalSamples << '\n';
+
+      SoundBankSlot slot;
+      if (_soundBankBuilder.getSlot(entry.header.hashValue, slot)) {
+        _combinedSoundDestStream << "bank " << slot.offset << ' '
+                                 << slot.size << '\n';
+      }
+      _combinedSoundDestStream << '\n';
     } else  //"image"         == entry.type ||
             //"sprite"        == entry.type ||
             //"sprite_manual" == entry.type
@@ -233,25 +567,214 @@ void FileBuilder::fillCombinedDestFile(const std::vector<CombinedData>& data) {
 
       _combinedResDestStream
           << entry.header.path << '\n'
-          << entry.header.fileSize << '\n'
+          << entry.fileSize << '\n'
           << entry.textureLoadType << '\n'
           << entry.imageRect.x << ' ' << entry.imageRect.y << ' '
           << entry.imageRect.w << ' ' << entry.imageRect.h << '\n';
 
-      _combinedResDestStream << entry.spriteData.size() << '\n';
+      SpriteGrid grid;
+      if (_compactSprites && ("sprite" == entry.type) &&
+          SpriteGrid::fromFrames(entry.spriteData, grid)) {
+        _combinedResDestStream
+            << "grid " << grid.count << ' ' << grid.columns << ' '
+            << grid.originX << ' ' << grid.originY << ' '
+            << grid.frameWidth << ' ' << grid.frameHeight << ' '
+            << grid.spacingX << ' ' << grid.spacingY << '\n';
+      } else {
+        _combinedResDestStream << entry.spriteData.size() << '\n';
+
+        for (const auto& sprite : entry.spriteData) {
+          _combinedResDestStream
+              << sprite.x << ' ' << sprite.y << ' '
+              << sprite.w << ' ' << sprite.h
+              << '\n';
+        }
+      }
+      writeDigest(_combinedResDestStream, entry.contentDigest);
 
-      for (const auto& sprite : entry.spriteData) {
+      const ImageInfo& imageInfo = entry.imageInfo;
+      if (imageInfo.isPng) {
         _combinedResDestStream
-            << sprite.x << ' ' << sprite.y << ' '
-            << sprite.w << ' ' << sprite.h
-            << '\n';
+            << "png " << imageInfo.bitDepth << ' ' << imageInfo.colorType
+            << ' ' << imageInfo.interlaced << ' '
+            << imageInfo.hasTransparency << ' ' << imageInfo.hasGamma << '\n';
+      }
+
+      if (TextureContainer::NONE != imageInfo.container) {
+        _combinedResDestStream
+            << "gpu_texture " << getContainerName(imageInfo.container) << ' '
+            << imageInfo.format << ' ' << imageInfo.mipCount << ' '
+            << imageInfo.layerCount << ' ' << imageInfo.gpuSize << '\n';
+      }
+
+      if (!entry.frameTrims.empty()) {
+        writeFrameTrims(_combinedResDestStream, entry.frameTrims);
+      }
+
+      if (!entry.frameRemap.empty()) {
+        _combinedResDestStream << "frame_remap " << entry.frameRemap.size();
+        for (const uint32_t frameIdx : entry.frameRemap) {
+          _combinedResDestStream << ' ' << frameIdx;
+        }
+        _combinedResDestStream << '\n';
+      }
+
+      if (SpriteUvMode::NONE != _spriteUvMode) {
+        writeSpriteUvs(_combinedResDestStream, entry, _spriteUvMode);
+      }
+
+      std::string blobName;
+      if (_textureCacheBuilder.getBlobName(entry.header.hashValue,
+                                           blobName)) {
+        _combinedResDestStream << "texture_cache " << blobName << '\n';
+      }
+
+      const std::vector<TextureLod>* lods =
+          _lodBuilder.getLods(entry.header.hashValue);
+      if (nullptr != lods) {
+        for (const TextureLod& lod : *lods) {
+          writeTextureLod(_combinedResDestStream, lod);
+        }
       }
       _combinedResDestStream << '\n';
     }
   }
 }
 
-void FileBuilder::autoGenerateResFile(const std::vector<CombinedData>& data) {
+void FileBuilder::fillCombinedIndicesFile(
+    const std::vector<BuilderCombinedData>& data) {
+  // indices follow the combined files - widgets, then fonts, then sounds
+  std::vector<const BuilderCombinedData*> indexedData;
+  indexedData.reserve(data.size());
+  for (const auto& entry : data) {
+    if (isWidget(entry)) {
+      indexedData.push_back(&entry);
+    }
+  }
+  const uint64_t fontsBeginIdx = indexedData.size();
+  for (const auto& entry : data) {
+    if ("font" == entry.type) {
+      indexedData.push_back(&entry);
+    }
+  }
+  const uint64_t soundsBeginIdx = indexedData.size();
+  for (const auto& entry : data) {
+    if ("sound" == entry.type) {
+      indexedData.push_back(&entry);
+    }
+  }
+
+  // ordered map is used, so the namespaces are always produced
+  // in the same order
+  std::map<std::string, std::vector<uint64_t>> namespaceIndices;
+  for (uint64_t i = 0; i < indexedData.size(); ++i) {
+    namespaceIndices[indexedData[i]->resourceNamespace].push_back(i);
+  }
+
+  _combinedIndicesDestStream
+      << ResourceFileHeader::getResourceFileHeader() << "#ifndef "
+      << _headerGuardsIndices << '\n'
+      << "#define " << _headerGuardsIndices << "\n\n"
+      << "#include <cstdint>\n\n";
+
+  for (const auto& [namespaceName, indices] : namespaceIndices) {
+    _combinedIndicesDestStream
+        << "namespace " << namespaceName << "\n{\n"
+        << TAB << "enum class ResourceIndex : " << INDEX_DATA_TYPE << "\n"
+        << TAB << "{\n";
+
+    for (const uint64_t idx : indices) {
+      _combinedIndicesDestStream << TAB << TAB << indexedData[idx]->tagName
+                                 << " = " << idx << ",\n";
+    }
+
+    _combinedIndicesDestStream
+        << TAB << "}; /* enum class ResourceIndex */\n"
+        << "} /* namespace " << namespaceName << " */\n\n";
+  }
+
+  // the lookup table is sorted by hash value so it can be binary searched
+  std::vector<uint64_t> hashOrder(indexedData.size());
+  for (uint64_t i = 0; i < hashOrder.size(); ++i) {
+    hashOrder[i] = i;
+  }
+  std::sort(hashOrder.begin(), hashOrder.end(),
+      [&indexedData](const uint64_t lhs, const uint64_t rhs) {
+        return indexedData[lhs]->header.hashValue <
+               indexedData[rhs]->header.hashValue;
+      });
+
+  _combinedIndicesDestStream
+      << "namespace " << INDICES_NAMESPACE << "\n{\n"
+      << TAB << "inline constexpr " << INDEX_DATA_TYPE
+      << " WIDGETS_BEGIN_INDEX = 0;\n"
+      << TAB << "inline constexpr " << INDEX_DATA_TYPE
+      << " FONTS_BEGIN_INDEX = " << fontsBeginIdx << ";\n"
+      << TAB << "inline constexpr " << INDEX_DATA_TYPE
+      << " SOUNDS_BEGIN_INDEX = " << soundsBeginIdx << ";\n"
+      << TAB << "inline constexpr " << INDEX_DATA_TYPE
+      << " RESOURCES_COUNT = " << indexedData.size() << ";\n"
+      << TAB << "inline constexpr " << INDEX_DATA_TYPE
+      << " INVALID_RESOURCE_INDEX = UINT32_MAX;\n\n"
+      << TAB << "struct HashIndexPair\n"
+      << TAB << "{\n"
+      << TAB << TAB << "uint64_t hashValue;\n"
+      << TAB << TAB << INDEX_DATA_TYPE << " index;\n"
+      << TAB << "};\n\n"
+      << TAB << "/* sorted by hashValue */\n"
+      << TAB << "inline constexpr HashIndexPair HASH_TO_INDEX[] =\n"
+      << TAB << "{\n";
+
+  for (const uint64_t idx : hashOrder) {
+    _combinedIndicesDestStream << TAB << TAB << "{ ";
+    writeHex(_combinedIndicesDestStream, indexedData[idx]->header.hashValue);
+    _combinedIndicesDestStream << ", " << idx << " }, /* "
+                               << indexedData[idx]->tagName << " */\n";
+  }
+
+  // zero sized arrays are not allowed. The entry is never looked up
+  if (indexedData.empty()) {
+    _combinedIndicesDestStream << TAB << TAB
+                               << "{ 0, INVALID_RESOURCE_INDEX }\n";
+  }
+
+  _combinedIndicesDestStream
+      << TAB << "};\n\n"
+      << TAB << "/* returns INVALID_RESOURCE_INDEX if the provided hash "
+      << "value is unknown */\n"
+      << TAB << "constexpr " << INDEX_DATA_TYPE
+      << " findResourceIndex(const uint64_t hashValue)\n"
+      << TAB << "{\n"
+      << TAB << TAB << INDEX_DATA_TYPE << " first = 0;\n"
+      << TAB << TAB << INDEX_DATA_TYPE << " last = RESOURCES_COUNT;\n"
+      << TAB << TAB << "while (first < last)\n"
+      << TAB << TAB << "{\n"
+      << TAB << TAB << TAB << "const " << INDEX_DATA_TYPE
+      << " mid = first + (last - first) / 2;\n"
+      << TAB << TAB << TAB << "if (HASH_TO_INDEX[mid].hashValue < "
+      << "hashValue)\n"
+      << TAB << TAB << TAB << "{\n"
+      << TAB << TAB << TAB << TAB << "first = mid + 1;\n"
+      << TAB << TAB << TAB << "}\n"
+      << TAB << TAB << TAB << "else\n"
+      << TAB << TAB << TAB << "{\n"
+      << TAB << TAB << TAB << TAB << "last = mid;\n"
+      << TAB << TAB << TAB << "}\n"
+      << TAB << TAB << "}\n\n"
+      << TAB << TAB << "if ((first < RESOURCES_COUNT) &&\n"
+      << TAB << TAB << TAB << "(HASH_TO_INDEX[first].hashValue == "
+      << "hashValue))\n"
+      << TAB << TAB << "{\n"
+      << TAB << TAB << TAB << "return HASH_TO_INDEX[first].index;\n"
+      << TAB << TAB << "}\n\n"
+      << TAB << TAB << "return INVALID_RESOURCE_INDEX;\n"
+      << TAB << "}\n"
+      << "} /* namespace " << INDICES_NAMESPACE << " */\n\n"
+      << "#endif /* " << _headerGuardsIndices << " */";
+}
+
+void FileBuilder::autoGenerateResFile(
+    const std::vector<BuilderCombinedData>& data) {
   // Write header file
   _destStreamStatic << ResourceFileHeader::getResourceFileHeader() << "#ifndef "
                     << _headerGuardsStatic << '\n'
@@ -282,9 +805,9 @@ void FileBuilder::autoGenerateResFile(const std::vector<CombinedData>& data) {
   // reused multiple times
   std::ostringstream hexHashValue;
 
-  int32_t itemsSize = 0;  // in kBytes
+  uint64_t itemsSize = 0;  // in bytes
   for (const auto &dataEntry : data) {
-    itemsSize += dataEntry.header.fileSize;
+    itemsSize += dataEntry.fileSize;
 
     // set stream basefield manipulator to uppercase hex
     hexHashValue << std::hex << std::uppercase;
@@ -332,7 +855,7 @@ void FileBuilder::autoGenerateResFile(const std::vector<CombinedData>& data) {
   _destStreamDynamicValues << "*/";
 
   const std::string ITEMS_SIZE_MB =
-      std::to_string(static_cast<double>(itemsSize) / 1024);
+      std::to_string(static_cast<double>(itemsSize) / BYTES_PER_MB);
   const size_t DOT_POS = ITEMS_SIZE_MB.find('.');
 
   std::string itemsSizeMbStr =
@@ -343,9 +866,110 @@ void FileBuilder::autoGenerateResFile(const std::vector<CombinedData>& data) {
                    itemsSizeMbStr.c_str());
 }
 
+ErrorCode FileBuilder::finishLoadGroupFiles() {
+  // ordered map is used, so the manifests are always produced
+  // in the same order
+  std::map<std::string, std::vector<BuilderCombinedData>> loadGroups;
+  for (const auto& entry : _combinedData) {
+    if (!entry.group.empty()) {
+      loadGroups[entry.group].push_back(entry);
+    }
+  }
+
+  const std::filesystem::path groupsDir =
+      std::filesystem::path(_combinedDestDir) / LOAD_GROUPS_FOLDER_NAME;
+
+  std::error_code errorCode;
+  if (!loadGroups.empty()) {
+    std::filesystem::create_directories(groupsDir, errorCode);
+    if (errorCode) {
+      LOGERR("Error, could not create directory: %s, reason: %s",
+             groupsDir.string().c_str(), errorCode.message().c_str());
+      return ErrorCode::FAILURE;
+    }
+  }
+
+  AtomicFileStream groupStream;
+  for (const auto& [group, data] : loadGroups) {
+    const std::string fileName =
+        (groupsDir / (group + LOAD_GROUP_FILE_EXTENSION)).string();
+
+    if (ErrorCode::SUCCESS != groupStream.begin(fileName)) {
+      LOGERR("Error in groupStream.begin()");
+      return ErrorCode::FAILURE;
+    }
+
+    fillLoadGroupFile(groupStream, group, data);
+
+    if (ErrorCode::SUCCESS != groupStream.publish(_syncOutputFiles)) {
+      LOGERR("Error, could not publish: %s", fileName.c_str());
+      return ErrorCode::FAILURE;
+    }
+  }
+
+  // remove manifests of load groups, which are no longer described
+  if (!std::filesystem::is_directory(groupsDir, errorCode)) {
+    return ErrorCode::SUCCESS;
+  }
+
+  for (const auto& dirEntry :
+       std::filesystem::directory_iterator(groupsDir, errorCode)) {
+    const std::filesystem::path& path = dirEntry.path();
+    if ((LOAD_GROUP_FILE_EXTENSION == path.extension().string()) &&
+        (loadGroups.end() == loadGroups.find(path.stem().string()))) {
+      std::filesystem::remove(path, errorCode);
+    }
+  }
+
+  return ErrorCode::SUCCESS;
+}
+
+void FileBuilder::fillLoadGroupFile(
+    AtomicFileStream& stream, const std::string& group,
+    const std::vector<BuilderCombinedData>& data) {
+  uint64_t widgetsCount = 0;
+  uint64_t fontsCount = 0;
+  uint64_t soundsCount = 0;
+  uint64_t totalFileSize = 0;
+
+  for (const auto& entry : data) {
+    if ("font" == entry.type) {
+      ++fontsCount;
+    } else if ("sound" == entry.type) {
+      ++soundsCount;
+    } else {
+      ++widgetsCount;
+    }
+    totalFileSize += entry.fileSize;
+  }
+
+  stream << "#group: " << group << '\n'
+         << "#widgets: " << widgetsCount << '\n'
+         << "#fonts: " << fontsCount << '\n'
+         << "#sounds: " << soundsCount << '\n'
+         << ResourceFileHeader::getEngineFileSizeHeader() << totalFileSize
+         << "\n\n";
+
+  for (const auto& entry : data) {
+    stream << std::hex << std::uppercase;
+    stream << "0x" << std::setw(MAX_UINT64_T_HEX_LENGTH) << std::setfill('0')
+           << entry.header.hashValue << '\n';
+    stream << std::dec << std::nouppercase;
+
+    stream << entry.type << '\n'
+           << entry.header.path << '\n'
+           << entry.fileSize << "\n\n";
+  }
+
+  LOG_ON_SAME_LINE("%s%s generation ... (%zu files with size: %.3f MB) ",
+                   group.c_str(), LOAD_GROUP_FILE_EXTENSION, data.size(),
+                   static_cast<double>(totalFileSize) / BYTES_PER_MB);
+  LOGG("[Done]");
+}
+
 void FileBuilder::finishCombinedResFile(const uint64_t staticWidgetsCount,
                                         const uint64_t dynamicWidgetsCount,
-                                        const int32_t totalWidgetFileSize) {
+                                        const uint64_t totalWidgetFileSize) {
   const uint64_t widgetHeaderSize =
       ResourceFileHeader::getEngineResHeader().size();
   const uint64_t widgetAdditionSize =
@@ -404,7 +1028,7 @@ void FileBuilder::finishCombinedResFile(const uint64_t staticWidgetsCount,
 }
 
 void FileBuilder::finishCombinedFontFile(const uint64_t fontsCount,
-                                         const int32_t totalFontsFileSize) {
+                                         const uint64_t totalFontsFileSize) {
   const uint64_t fontHeaderSize =
       ResourceFileHeader::getEngineFontHeader().size();
   const uint64_t engineValueHeaderSize =
@@ -445,7 +1069,7 @@ void FileBuilder::finishCombinedFontFile(const uint64_t fontsCount,
 
 void FileBuilder::finishCombinedSoundFile(const uint64_t musicsCount,
                                           const uint64_t chunksCount,
-                                          const int32_t totalSoundsFileSize) {
+                                          const uint64_t totalSoundsFileSize) {
   const uint64_t soundHeaderSize =
       ResourceFileHeader::getEngineSoundHeader().size();
   const uint64_t engineValueHeaderSize =
@@ -0,0 +1,111 @@
+// Corresponding header
+#include "resource_builder/FileLock.h"
+
+// System headers
+#if defined(_WIN32) || defined(_WIN64)
+  #include <windows.h>
+#else //linux
+  #include <fcntl.h>
+  #include <sys/file.h>
+  #include <unistd.h>
+  #include <cerrno>
+#endif
+
+// Other libraries headers
+#include "utils/debug/StrError.h"
+#include "utils/log/Log.h"
+
+// Own components headers
+
+FileLock::~FileLock() noexcept { unlock(); }
+
+#if defined(_WIN32) || defined(_WIN64)
+ErrorCode FileLock::lock(const std::string& lockFileName) {
+  unlock();
+
+  HANDLE handle = CreateFileA(lockFileName.c_str(),
+      GENERIC_READ | GENERIC_WRITE, FILE_SHARE_READ | FILE_SHARE_WRITE,
+      nullptr, OPEN_ALWAYS, FILE_ATTRIBUTE_NORMAL, nullptr);
+  if (INVALID_HANDLE_VALUE == handle) {
+    LOGERR("Error, could not open lock file: %s, error code: %lu",
+           lockFileName.c_str(), GetLastError());
+    return ErrorCode::FAILURE;
+  }
+
+  OVERLAPPED overlapped = {};
+  if (!LockFileEx(handle, LOCKFILE_EXCLUSIVE_LOCK | LOCKFILE_FAIL_IMMEDIATELY,
+                  0, MAXDWORD, MAXDWORD, &overlapped)) {
+    LOG("Output directory is locked by another resource_builder instance. "
+        "Waiting on %s", lockFileName.c_str());
+
+    if (!LockFileEx(handle, LOCKFILE_EXCLUSIVE_LOCK, 0, MAXDWORD, MAXDWORD,
+                    &overlapped)) {
+      LOGERR("Error, could not lock: %s, error code: %lu",
+             lockFileName.c_str(), GetLastError());
+      CloseHandle(handle);
+      return ErrorCode::FAILURE;
+    }
+  }
+
+  _handle = handle;
+  _lockFileName = lockFileName;
+
+  return ErrorCode::SUCCESS;
+}
+
+void FileLock::unlock() {
+  if (nullptr == _handle) {
+    return;
+  }
+
+  OVERLAPPED overlapped = {};
+  UnlockFileEx(_handle, 0, MAXDWORD, MAXDWORD, &overlapped);
+  CloseHandle(_handle);
+  _handle = nullptr;
+  _lockFileName.clear();
+}
+#else //linux
+ErrorCode FileLock::lock(const std::string& lockFileName) {
+  unlock();
+
+  const int32_t fd = open(lockFileName.c_str(), O_RDWR | O_CREAT, 0644);
+  if (0 > fd) {
+    LOGERR("Error, could not open lock file: %s, reason: %s",
+           lockFileName.c_str(), strError().c_str());
+    return ErrorCode::FAILURE;
+  }
+
+  if (0 != flock(fd, LOCK_EX | LOCK_NB)) {
+    LOG("Output directory is locked by another resource_builder instance. "
+        "Waiting on %s", lockFileName.c_str());
+
+    int32_t result = 0;
+    do {
+      result = flock(fd, LOCK_EX);
+    } while ((0 != result) && (EINTR == errno));
+
+    if (0 != result) {
+      LOGERR("Error, could not lock: %s, reason: %s", lockFileName.c_str(),
+             strError().c_str());
+      close(fd);
+      return ErrorCode::FAILURE;
+    }
+  }
+
+  _fd = fd;
+  _lockFileName = lockFileName;
+
+  return ErrorCode::SUCCESS;
+}
+
+void FileLock::unlock() {
+  if (0 > _fd) {
+    return;
+  }
+
+  flock(_fd, LOCK_UN);
+  close(_fd);
+  _fd = -1;
+  _lockFileName.clear();
+}
+#endif
@@ -2,6 +2,13 @@
 #include "resource_builder/FileParser.h"
 
 // System headers
+#include <algorithm>
+#include <cctype>
+#include <cstring>
+#include <iterator>
+#include <span>
+#include <string_view>
+
 #if defined(_WIN32) || defined(_WIN64)
   #include <winsock.h>
 #else //linux
@@ -14,13 +21,105 @@
 #include "utils/log/Log.h"
 
 // Own components headers
+#include "resource_builder/ByteReader.h"
+#include "resource_builder/HashUtils.h"
+#include "resource_builder/OggPage.h"
 
 namespace {
+using namespace std::string_view_literals;
+
 #ifdef __linux__
 constexpr auto SLASH_IDENTIFIER = '/';
 #else
 constexpr auto SLASH_IDENTIFIER = '\\';
 #endif
+
+// signature (8) + IHDR length, type, data (13) and CRC
+constexpr int64_t PNG_FIRST_CHUNK_AFTER_IHDR = 33;
+constexpr int64_t PNG_CHUNK_HEADER_SIZE = 8;
+constexpr int64_t PNG_CHUNK_CRC_SIZE = 4;
+
+constexpr uint32_t CUBE_MAP_FACES = 6;
+
+// identifier (12), format and dimensions (36), index (32)
+constexpr int64_t KTX2_HEADER_SIZE = 80;
+constexpr int64_t KTX2_LEVEL_INDEX_ENTRY_SIZE = 24;
+constexpr uint8_t KTX2_IDENTIFIER[] = {0xAB, 'K',  'T',  'X',  ' ',  '2',
+                                       '0',  0xBB, 0x0D, 0x0A, 0x1A, 0x0A};
+
+// "DDS " magic (4) + DDS_HEADER (124)
+constexpr int64_t DDS_HEADER_SIZE = 128;
+constexpr int64_t DDS_DX10_HEADER_SIZE = 20;
+constexpr uint32_t DDS_HEADER_STRUCT_SIZE = 124;
+constexpr uint32_t DDS_PIXEL_FORMAT_STRUCT_SIZE = 32;
+constexpr uint32_t DDSD_MIPMAPCOUNT = 0x20000;
+constexpr uint32_t DDPF_FOURCC = 0x4;
+constexpr uint32_t DDPF_RGB = 0x40;
+constexpr uint32_t DDSCAPS2_CUBEMAP = 0x200;
+constexpr uint32_t DDSCAPS2_VOLUME = 0x200000;
+constexpr uint32_t DDS_DIMENSION_TEXTURE2D = 3;
+constexpr uint32_t DDS_RESOURCE_MISC_TEXTURECUBE = 0x4;
+constexpr uint32_t DXGI_FORMAT_R8G8B8A8_UNORM = 28;
+constexpr uint32_t DXGI_FORMAT_B8G8R8A8_UNORM = 87;
+constexpr uint32_t DXGI_FORMAT_B8G8R8X8_UNORM = 88;
+
+struct FourCcFormat {
+  const char* fourCc;
+  uint32_t dxgiFormat;
+};
+
+// legacy (pre DX10 header) block compressed formats
+constexpr FourCcFormat DDS_FOURCC_FORMATS[] = {
+    {"DXT1", 71}, {"DXT2", 74}, {"DXT3", 74}, {"DXT4", 77}, {"DXT5", 77},
+    {"ATI1", 80}, {"BC4U", 80}, {"BC4S", 81}, {"ATI2", 83}, {"BC5U", 83},
+    {"BC5S", 84}};
+
+constexpr int64_t ASTC_HEADER_SIZE = 16;
+constexpr uint64_t ASTC_BLOCK_SIZE = 16;
+constexpr uint8_t ASTC_MAGIC[] = {0x13, 0xAB, 0xA1, 0x5C};
+constexpr uint32_t VK_FORMAT_ASTC_4x4_UNORM_BLOCK = 157;
+
+struct AstcBlock {
+  uint32_t width;
+  uint32_t height;
+};
+
+// 2D block footprints in the order of their VkFormat values
+constexpr AstcBlock ASTC_BLOCKS[] = {
+    {4, 4},  {5, 4},  {5, 5},  {6, 5},   {6, 6},   {8, 5},   {8, 6},
+    {8, 8},  {10, 5}, {10, 6}, {10, 8},  {10, 10}, {12, 10}, {12, 12}};
+
+constexpr int64_t RIFF_HEADER_SIZE = 12;
+constexpr int64_t RIFF_CHUNK_HEADER_SIZE = 8;
+constexpr int64_t WAV_FMT_MIN_SIZE = 16;
+constexpr uint16_t WAV_FORMAT_PCM = 1;
+constexpr uint16_t WAV_FORMAT_IEEE_FLOAT = 3;
+constexpr uint16_t WAV_FORMAT_EXTENSIBLE = 0xFFFE;
+
+// RIFF header (12) + first chunk header (8) + VP8X canvas (10)
+constexpr int64_t WEBP_HEADER_SIZE = 30;
+constexpr uint8_t VP8_START_CODE[] = {0x9D, 0x01, 0x2A};
+constexpr uint8_t VP8L_SIGNATURE = 0x2F;
+constexpr uint32_t WEBP_BIT_DEPTH = 8;
+
+constexpr int64_t QOI_HEADER_SIZE = 14;
+constexpr uint32_t QOI_BIT_DEPTH = 8;
+
+constexpr int64_t OGG_PAGE_HEADER_SIZE =
+    static_cast<int64_t>(OggPage::HEADER_SIZE);
+constexpr int64_t OGG_SERIAL_OFFSET = 14;
+constexpr int64_t VORBIS_ID_HEADER_SIZE = 30;
+
+// the last Ogg page is guaranteed to be within that range from the end
+constexpr int64_t OGG_MAX_PAGE_SIZE = 65307;
+
+constexpr int64_t SFNT_HEADER_SIZE = 12;
+constexpr int64_t SFNT_TABLE_RECORD_SIZE = 16;
+constexpr int64_t TTC_HEADER_SIZE = 16;
+constexpr int64_t HEAD_TABLE_MIN_SIZE = 54;
+constexpr int64_t HHEA_TABLE_MIN_SIZE = 36;
+constexpr int64_t MAXP_TABLE_MIN_SIZE = 6;
+constexpr int64_t OS2_TABLE_MIN_SIZE = 4;
 }
 
 FileParser::FileParser()
@@ -75,6 +174,24 @@ ErrorCode FileParser::openFile() {
   return ErrorCode::SUCCESS;
 }
 
+ErrorCode FileParser::readContentDigest(uint64_t& outDigest) {
+  // the header parsing may have stopped the stream at the end of file
+  _fileStream.clear();
+  _fileStream.seekg(0, std::ifstream::beg);
+
+  std::vector<uint8_t> content(static_cast<size_t>(_fileSize));
+  _fileStream.read(reinterpret_cast<char*>(content.data()),
+                   static_cast<std::streamsize>(content.size()));
+  if (_fileStream.gcount() != static_cast<std::streamsize>(_fileSize)) {
+    LOGERR("Error, could not read %" PRId64 " bytes of file: %s, reason: %s",
+           _fileSize, _absoluteFilePath.c_str(), strError().c_str());
+    return ErrorCode::FAILURE;
+  }
+
+  outDigest = HashUtils::hashData(content.data(), content.size());
+  return ErrorCode::SUCCESS;
+}
+
 void FileParser::closeFileAndReset() {
   _spriteDes = nullptr;
   _isGraphicalFile = false;
@@ -82,6 +199,9 @@ void FileParser::closeFileAndReset() {
   _imageWidth = 0;
   _imageHeight = 0;
   _fileSize = 0;
+  _soundInfo = SoundInfo();
+  _fontInfo = FontInfo();
+  _imageInfo = ImageInfo();
 
   // close stream and clear stream flags
   _fileStream.close();
@@ -91,6 +211,18 @@ void FileParser::closeFileAndReset() {
 bool FileParser::isSupportedExtension() {
   bool success = false;
 
+  // the magic bytes take precedence over a missing or a wrong extension
+  const FileType contentType = getFileTypeFromContent();
+  if ((FileType::UNKNOWN != contentType) && (contentType != _currFileType) &&
+      !(isFontFileType(contentType) && isFontFileType(_currFileType))) {
+    if (FileType::UNKNOWN != _currFileType) {
+      LOGR("Warning, content of file: %s does not match it's extension. It "
+           "will be parsed by it's content", _absoluteFilePath.c_str());
+    }
+    _currFileType = contentType;
+    _isGraphicalFile = isGraphicalFileType(contentType);
+  }
+
   switch (_currFileType) {
     case FileType::PNG:
       success = isValidPngFile();
@@ -104,24 +236,42 @@ bool FileParser::isSupportedExtension() {
       success = isValidGifFile();
       break;
 
-    case FileType::OTF:
-      success = true;  // no validation on this stage for .otf extension
+    case FileType::WEBP:
+      success = isValidWebpFile();
       break;
 
+    case FileType::QOI:
+      success = isValidQoiFile();
+      break;
+
+    case FileType::KTX2:
+      success = isValidKtx2File();
+      break;
+
+    case FileType::DDS:
+      success = isValidDdsFile();
+      break;
+
+    case FileType::ASTC:
+      success = isValidAstcFile();
+      break;
+
+    case FileType::OTF:
     case FileType::TTF:
-      success = true;  // no validation on this stage for .ttf extension
+      success = isValidFontFile();
       break;
 
     case FileType::WAV:
-      success = true;  // no validation on this stage for .wav extension
+      success = isValidWavFile();
       break;
 
     case FileType::OGG:
-      success = true;  // no validation on this stage for .ogg extension
+      success = isValidOggFile();
       break;
 
     default:
-      LOGERR("Unknown file extension on file: %s", _absoluteFilePath.c_str());
+      LOGERR("Unknown file extension and content on file: %s",
+             _absoluteFilePath.c_str());
       break;
   }
 
@@ -146,42 +296,113 @@ void FileParser::buildAbsoluteFilePath() {
 }
 
 void FileParser::setFileTypeInternal() {
-  const uint8_t MAX_EXTENSION_SIZE = 3;
-  const std::string extension = _absoluteFilePath.substr(
-      _absoluteFilePath.size() - MAX_EXTENSION_SIZE, MAX_EXTENSION_SIZE);
-  if (MAX_EXTENSION_SIZE < extension.size()) {
-    _currFileType = FileType::UNKNOWN;
-    _isGraphicalFile = false;
-    return;
-  }
-
-  if ("png" == extension) {
-    _currFileType = FileType::PNG;
-    _isGraphicalFile = true;
-  } else if ("jpg" == extension) {
-    _currFileType = FileType::JPG;
-    _isGraphicalFile = true;
-  } else if ("gif" == extension) {
-    _currFileType = FileType::GIF;
-    _isGraphicalFile = true;
-  } else if ("otf" == extension) {
-    _currFileType = FileType::OTF;
-    _isGraphicalFile = true;
-  } else if ("ttf" == extension) {
-    _currFileType = FileType::TTF;
-    _isGraphicalFile = true;
-  } else if ("wav" == extension) {
-    _currFileType = FileType::WAV;
-    _isGraphicalFile = false;
-  } else if ("ogg" == extension) {
-    _currFileType = FileType::OGG;
-    _isGraphicalFile = false;
-  } else {
-    _currFileType = FileType::UNKNOWN;
-    _isGraphicalFile = false;
+  // extensions have arbitrary length (e.g. .ktx2, .webp)
+  const size_t dotPos = _absoluteFilePath.rfind('.');
+  std::string extension = (std::string::npos == dotPos)
+                              ? std::string()
+                              : _absoluteFilePath.substr(dotPos + 1);
+  std::transform(extension.begin(), extension.end(), extension.begin(),
+                 [](const unsigned char c) {
+                   return static_cast<char>(tolower(c));
+                 });
+
+  _currFileType = getFileTypeFromExtension(extension);
+  _isGraphicalFile = isGraphicalFileType(_currFileType);
+}
+
+FileParser::FileType FileParser::getFileTypeFromExtension(
+    const std::string& extension) {
+  struct ExtensionType {
+    const char* extension;
+    FileType type;
+  };
+
+  static constexpr ExtensionType EXTENSION_TYPES[] = {
+      {"png", FileType::PNG},   {"jpg", FileType::JPG},
+      {"jpeg", FileType::JPG},  {"gif", FileType::GIF},
+      {"webp", FileType::WEBP}, {"qoi", FileType::QOI},
+      {"ktx2", FileType::KTX2}, {"dds", FileType::DDS},
+      {"astc", FileType::ASTC}, {"otf", FileType::OTF},
+      {"ttf", FileType::TTF},   {"wav", FileType::WAV},
+      {"ogg", FileType::OGG}};
+
+  for (const auto& extensionType : EXTENSION_TYPES) {
+    if (extension == extensionType.extension) {
+      return extensionType.type;
+    }
+  }
+
+  return FileType::UNKNOWN;
+}
+
+FileParser::FileType FileParser::getFileTypeFromContent() {
+  struct FileSignature {
+    std::string_view magic;
+
+    /* Format identifier inside a generic container (e.g. RIFF) */
+    int64_t formatOffset;
+    std::string_view format;
+
+    FileType type;
+  };
+
+  static constexpr FileSignature SIGNATURES[] = {
+      {"\x89PNG\r\n\x1A\n"sv, 0, ""sv, FileType::PNG},
+      {"\xFF\xD8\xFF"sv, 0, ""sv, FileType::JPG},
+      {"GIF8"sv, 0, ""sv, FileType::GIF},
+      {"RIFF"sv, 8, "WEBP"sv, FileType::WEBP},
+      {"qoif"sv, 0, ""sv, FileType::QOI},
+      {"\xABKTX 20\xBB\r\n\x1A\n"sv, 0, ""sv, FileType::KTX2},
+      {"DDS "sv, 0, ""sv, FileType::DDS},
+      {"\x13\xAB\xA1\x5C"sv, 0, ""sv, FileType::ASTC},
+      {"OTTO"sv, 0, ""sv, FileType::OTF},
+      {"\0\1\0\0"sv, 0, ""sv, FileType::TTF},
+      {"true"sv, 0, ""sv, FileType::TTF},
+      {"ttcf"sv, 0, ""sv, FileType::TTF},
+      {"RIFF"sv, 8, "WAVE"sv, FileType::WAV},
+      {"OggS"sv, 0, ""sv, FileType::OGG}};
+
+  constexpr int64_t MAX_SIGNATURE_SIZE = 12;
+  char header[MAX_SIGNATURE_SIZE] = {0};
+  _fileStream.seekg(0, std::ifstream::beg);
+  _fileStream.read(header, MAX_SIGNATURE_SIZE);
+  const std::string_view content(
+      header, static_cast<size_t>(_fileStream.gcount()));
+  _fileStream.clear();
+
+  for (const auto& signature : SIGNATURES) {
+    const size_t formatPos = static_cast<size_t>(signature.formatOffset);
+    if ((content.substr(0, signature.magic.size()) == signature.magic) &&
+        (content.substr(std::min(formatPos, content.size()),
+                        signature.format.size()) == signature.format)) {
+      return signature.type;
+    }
+  }
+
+  return FileType::UNKNOWN;
+}
+
+bool FileParser::isGraphicalFileType(const FileType type) {
+  switch (type) {
+    case FileType::PNG:
+    case FileType::JPG:
+    case FileType::GIF:
+    case FileType::WEBP:
+    case FileType::QOI:
+    case FileType::KTX2:
+    case FileType::DDS:
+    case FileType::ASTC:
+      return true;
+
+    default:
+      return false;
   }
 }
 
+bool FileParser::isFontFileType(const FileType type) {
+  return (FileType::OTF == type) || (FileType::TTF == type);
+}
+
 bool FileParser::isValidPngFile() {
   bool success = true;
 
@@ -261,11 +482,57 @@ bool FileParser::isValidPngFile() {
     // width and height are guaranteed by the standard to be in big endianess
     _imageWidth = ntohl(_imageWidth);
     _imageHeight = ntohl(_imageHeight);
+
+    // the rest of IHDR: bit depth, color type, compression, filter, interlace
+    constexpr int32_t IHDR_TAIL_SIZE = 5;
+    constexpr int32_t COLOR_TYPE_IDX = 1;
+    constexpr int32_t INTERLACE_IDX = 4;
+    uint8_t ihdrTail[IHDR_TAIL_SIZE] = {0};
+    _fileStream.read(reinterpret_cast<char*>(ihdrTail), IHDR_TAIL_SIZE);
+    if (IHDR_TAIL_SIZE == _fileStream.gcount()) {
+      _imageInfo.isPng = true;
+      _imageInfo.bitDepth = ihdrTail[0];
+      _imageInfo.colorType = ihdrTail[COLOR_TYPE_IDX];
+      _imageInfo.interlaced = (0 != ihdrTail[INTERLACE_IDX]);
+      readPngAncillaryChunks();
+    }
+    _fileStream.clear();
   }
 
   return success;
 }
 
+void FileParser::readPngAncillaryChunks() {
+  // tRNS and gAMA must precede the first IDAT chunk
+  int64_t pos = PNG_FIRST_CHUNK_AFTER_IHDR;
+  uint8_t chunkHeader[PNG_CHUNK_HEADER_SIZE] = {0};
+
+  while (pos + PNG_CHUNK_HEADER_SIZE <= _fileSize) {
+    _fileStream.seekg(pos, std::ifstream::beg);
+    _fileStream.read(reinterpret_cast<char*>(chunkHeader),
+                     PNG_CHUNK_HEADER_SIZE);
+    if (PNG_CHUNK_HEADER_SIZE != _fileStream.gcount()) {
+      break;
+    }
+
+    const uint32_t length = ByteReader::readBigEndian32(chunkHeader);
+    const uint8_t* type = chunkHeader + sizeof(length);
+    if ((0 == memcmp(type, "IDAT", 4)) || (0 == memcmp(type, "IEND", 4))) {
+      break;
+    }
+
+    if (0 == memcmp(type, "tRNS", 4)) {
+      _imageInfo.hasTransparency = true;
+    } else if (0 == memcmp(type, "gAMA", 4)) {
+      _imageInfo.hasGamma = true;
+    }
+
+    // chunk data is followed by a 4 byte CRC
+    pos += PNG_CHUNK_HEADER_SIZE + static_cast<int64_t>(length) +
+           PNG_CHUNK_CRC_SIZE;
+  }
+}
+
 bool FileParser::isValidGifFile() {
   bool success = true;
 
@@ -440,11 +707,729 @@ bool FileParser::isValidJpgFile() {
 
     _imageHeight = (buf[7] << 8) + buf[8];
     _imageWidth = (buf[9] << 8) + buf[10];
+
+    // SOF2 and SOF10 hold progressive (multi scan) images
+    _imageInfo.bitDepth = buf[6];
+    _imageInfo.progressive = (0xC2 == buf[3]) || (0xCA == buf[3]);
   }
 
   return success;
 }
 
+bool FileParser::isValidWebpFile() {
+  if (!_fileStream)  // sanity check
+  {
+    LOGERR("Internal error, ifstream for %s not opened",
+           _absoluteFilePath.c_str());
+    return false;
+  }
+
+  if (_fileSize < WEBP_HEADER_SIZE) {
+    LOGERR("Warning, file: %s is too small: %" PRId64" and has incomplete "
+           "webp header", _absoluteFilePath.c_str(), _fileSize);
+    return false;
+  }
+
+  uint8_t header[WEBP_HEADER_SIZE] = {0};
+  _fileStream.seekg(0, std::ifstream::beg);
+  _fileStream.read(reinterpret_cast<char*>(header), WEBP_HEADER_SIZE);
+
+  if ((0 != memcmp(header, "RIFF", 4)) ||
+      (0 != memcmp(header + 8, "WEBP", 4))) {
+    LOGERR("Error, file: %s has no RIFF/WEBP header",
+           _absoluteFilePath.c_str());
+    return false;
+  }
+
+  // the first chunk defines the bitstream and holds the dimensions
+  const uint8_t* chunkType = header + RIFF_HEADER_SIZE;
+  const std::span<const uint8_t> chunkData =
+      std::span<const uint8_t>(header).subspan(
+          RIFF_HEADER_SIZE + RIFF_CHUNK_HEADER_SIZE);
+  uint32_t width = 0;
+  uint32_t height = 0;
+
+  if (0 == memcmp(chunkType, "VP8 ", 4)) {
+    // lossy - 3 bytes frame tag, 3 bytes start code, 14 bit dimensions
+    if (0 != memcmp(chunkData.data() + 3, VP8_START_CODE,
+                    sizeof(VP8_START_CODE))) {
+      LOGERR("Error, file: %s has invalid VP8 start code",
+             _absoluteFilePath.c_str());
+      return false;
+    }
+    width = ByteReader::readLittleEndian16(chunkData, 6) & 0x3FFFU;
+    height = ByteReader::readLittleEndian16(chunkData, 8) & 0x3FFFU;
+  } else if (0 == memcmp(chunkType, "VP8L", 4)) {
+    // lossless - signature byte, 14 bit (width - 1) and (height - 1)
+    if (VP8L_SIGNATURE != chunkData[0]) {
+      LOGERR("Error, file: %s has invalid VP8L signature",
+             _absoluteFilePath.c_str());
+      return false;
+    }
+    const uint32_t bits = ByteReader::readLittleEndian32(chunkData, 1);
+    width = (bits & 0x3FFFU) + 1;
+    height = ((bits >> 14) & 0x3FFFU) + 1;
+  } else if (0 == memcmp(chunkType, "VP8X", 4)) {
+    // extended - flags, 3 reserved bytes, 24 bit canvas (size - 1)
+    width = ByteReader::readLittleEndian24(chunkData, 4) + 1;
+    height = ByteReader::readLittleEndian24(chunkData, 7) + 1;
+  } else {
+    LOGERR("Error, file: %s has unknown webp bitstream chunk",
+           _absoluteFilePath.c_str());
+    return false;
+  }
+
+  if ((0 == width) || (0 == height)) {
+    LOGERR("Error, file: %s has invalid dimensions: %ux%u",
+           _absoluteFilePath.c_str(), width, height);
+    return false;
+  }
+
+  _imageWidth = static_cast<int32_t>(width);
+  _imageHeight = static_cast<int32_t>(height);
+  _imageInfo.bitDepth = WEBP_BIT_DEPTH;
+
+  return true;
+}
+
+bool FileParser::isValidQoiFile() {
+  if (!_fileStream)  // sanity check
+  {
+    LOGERR("Internal error, ifstream for %s not opened",
+           _absoluteFilePath.c_str());
+    return false;
+  }
+
+  if (_fileSize < QOI_HEADER_SIZE) {
+    LOGERR("Warning, file: %s is too small: %" PRId64" and has incomplete "
+           "qoi header", _absoluteFilePath.c_str(), _fileSize);
+    return false;
+  }
+
+  uint8_t header[QOI_HEADER_SIZE] = {0};
+  _fileStream.seekg(0, std::ifstream::beg);
+  _fileStream.read(reinterpret_cast<char*>(header), QOI_HEADER_SIZE);
+
+  if (0 != memcmp(header, "qoif", 4)) {
+    LOGERR("Error, file: %s has no QOI header", _absoluteFilePath.c_str());
+    return false;
+  }
+
+  // width and height are big endian, followed by channels and colorspace
+  const uint32_t width = ByteReader::readBigEndian32(header, 4);
+  const uint32_t height = ByteReader::readBigEndian32(header, 8);
+  const uint8_t channels = header[12];
+  const uint8_t colorSpace = header[13];
+
+  if ((0 == width) || (0 == height) ||
+      (static_cast<uint32_t>(INT32_MAX) < width) ||
+      (static_cast<uint32_t>(INT32_MAX) < height) ||
+      ((3 != channels) && (4 != channels)) || (1 < colorSpace)) {
+    LOGERR("Error, file: %s has invalid qoi header (%ux%u, %u channels, "
+           "colorspace %u)", _absoluteFilePath.c_str(), width, height,
+           channels, colorSpace);
+    return false;
+  }
+
+  _imageWidth = static_cast<int32_t>(width);
+  _imageHeight = static_cast<int32_t>(height);
+  _imageInfo.bitDepth = QOI_BIT_DEPTH;
+
+  return true;
+}
+
+bool FileParser::isValidKtx2File() {
+  if (!_fileStream)  // sanity check
+  {
+    LOGERR("Internal error, ifstream for %s not opened",
+           _absoluteFilePath.c_str());
+    return false;
+  }
+
+  if (_fileSize < KTX2_HEADER_SIZE) {
+    LOGERR("Warning, file: %s is too small: %" PRId64" and has incomplete "
+           "ktx2 header", _absoluteFilePath.c_str(), _fileSize);
+    return false;
+  }
+
+  uint8_t header[KTX2_HEADER_SIZE] = {0};
+  _fileStream.seekg(0, std::ifstream::beg);
+  _fileStream.read(reinterpret_cast<char*>(header), KTX2_HEADER_SIZE);
+
+  if (0 != memcmp(header, KTX2_IDENTIFIER, sizeof(KTX2_IDENTIFIER))) {
+    LOGERR("Error, file: %s has no KTX2 identifier",
+           _absoluteFilePath.c_str());
+    return false;
+  }
+
+  const uint32_t width = ByteReader::readLittleEndian32(header, 20);
+  const uint32_t height = ByteReader::readLittleEndian32(header, 24);
+  const uint32_t depth = ByteReader::readLittleEndian32(header, 28);
+  const uint32_t layerCount = ByteReader::readLittleEndian32(header, 32);
+  const uint32_t faceCount = ByteReader::readLittleEndian32(header, 36);
+  const uint32_t levelCount = ByteReader::readLittleEndian32(header, 40);
+
+  // 1D and 3D textures can not be drawn as images
+  if ((0 == width) || (0 == height) || (0 != depth) ||
+      (static_cast<uint32_t>(INT32_MAX) < width) ||
+      (static_cast<uint32_t>(INT32_MAX) < height)) {
+    LOGERR("Error, file: %s is not a 2D texture (%ux%ux%u)",
+           _absoluteFilePath.c_str(), width, height, depth);
+    return false;
+  }
+
+  if ((1 != faceCount) && (CUBE_MAP_FACES != faceCount)) {
+    LOGERR("Error, file: %s has invalid face count: %u",
+           _absoluteFilePath.c_str(), faceCount);
+    return false;
+  }
+
+  // level count 0 requests mip generation at runtime - one level is stored
+  const uint32_t storedLevels = std::max(levelCount, 1U);
+  if (KTX2_HEADER_SIZE +
+          (storedLevels * KTX2_LEVEL_INDEX_ENTRY_SIZE) > _fileSize) {
+    LOGERR("Error, file: %s has incomplete ktx2 level index",
+           _absoluteFilePath.c_str());
+    return false;
+  }
+
+  std::vector<uint8_t> levelIndex(
+      static_cast<size_t>(storedLevels * KTX2_LEVEL_INDEX_ENTRY_SIZE));
+  _fileStream.read(reinterpret_cast<char*>(levelIndex.data()),
+                   static_cast<std::streamsize>(levelIndex.size()));
+
+  uint64_t gpuSize = 0;
+  for (uint32_t level = 0; level < storedLevels; ++level) {
+    const std::span<const uint8_t> entry =
+        std::span<const uint8_t>(levelIndex).subspan(
+            level * KTX2_LEVEL_INDEX_ENTRY_SIZE, KTX2_LEVEL_INDEX_ENTRY_SIZE);
+    const uint64_t byteOffset = ByteReader::readLittleEndian64(entry);
+    const uint64_t byteLength = ByteReader::readLittleEndian64(entry, 8);
+    if ((byteOffset > static_cast<uint64_t>(_fileSize)) ||
+        (byteLength > static_cast<uint64_t>(_fileSize) - byteOffset)) {
+      LOGERR("Error, file: %s has out of bound mip level: %u",
+             _absoluteFilePath.c_str(), level);
+      return false;
+    }
+
+    // 0 for BasisLZ - the size depends on the runtime transcoding target
+    gpuSize += ByteReader::readLittleEndian64(entry, 16);
+  }
+
+  _imageWidth = static_cast<int32_t>(width);
+  _imageHeight = static_cast<int32_t>(height);
+  _imageInfo.container = TextureContainer::KTX2;
+  _imageInfo.format = ByteReader::readLittleEndian32(header, 12);
+  _imageInfo.mipCount = storedLevels;
+  _imageInfo.layerCount = std::max(layerCount, 1U) * faceCount;
+  _imageInfo.gpuSize = gpuSize;
+
+  return true;
+}
+
+bool FileParser::isValidDdsFile() {
+  if (!_fileStream)  // sanity check
+  {
+    LOGERR("Internal error, ifstream for %s not opened",
+           _absoluteFilePath.c_str());
+    return false;
+  }
+
+  if (_fileSize < DDS_HEADER_SIZE) {
+    LOGERR("Warning, file: %s is too small: %" PRId64" and has incomplete "
+           "dds header", _absoluteFilePath.c_str(), _fileSize);
+    return false;
+  }
+
+  uint8_t header[DDS_HEADER_SIZE + DDS_DX10_HEADER_SIZE] = {0};
+  _fileStream.seekg(0, std::ifstream::beg);
+  _fileStream.read(reinterpret_cast<char*>(header), DDS_HEADER_SIZE);
+
+  if ((0 != memcmp(header, "DDS ", 4)) ||
+      (DDS_HEADER_STRUCT_SIZE != ByteReader::readLittleEndian32(header, 4)) ||
+      (DDS_PIXEL_FORMAT_STRUCT_SIZE !=
+       ByteReader::readLittleEndian32(header, 76))) {
+    LOGERR("Error, file: %s has no DDS header", _absoluteFilePath.c_str());
+    return false;
+  }
+
+  const uint32_t flags = ByteReader::readLittleEndian32(header, 8);
+  const uint32_t height = ByteReader::readLittleEndian32(header, 12);
+  const uint32_t width = ByteReader::readLittleEndian32(header, 16);
+  const uint32_t mipMapCount = ByteReader::readLittleEndian32(header, 28);
+  const uint32_t pixelFormatFlags = ByteReader::readLittleEndian32(header, 80);
+  const uint8_t* fourCc = header + 84;
+  const uint32_t caps2 = ByteReader::readLittleEndian32(header, 112);
+
+  if ((0 == width) || (0 == height) || (0 != (caps2 & DDSCAPS2_VOLUME)) ||
+      (static_cast<uint32_t>(INT32_MAX) < width) ||
+      (static_cast<uint32_t>(INT32_MAX) < height)) {
+    LOGERR("Error, file: %s is not a 2D texture (%ux%u)",
+           _absoluteFilePath.c_str(), width, height);
+    return false;
+  }
+
+  int64_t dataPos = DDS_HEADER_SIZE;
+  uint32_t format = 0;
+  uint32_t layerCount =
+      (0 != (caps2 & DDSCAPS2_CUBEMAP)) ? CUBE_MAP_FACES : 1;
+
+  if ((0 != (pixelFormatFlags & DDPF_FOURCC)) &&
+      (0 == memcmp(fourCc, "DX10", 4))) {
+    dataPos += DDS_DX10_HEADER_SIZE;
+    if (dataPos > _fileSize) {
+      LOGERR("Error, file: %s has incomplete dds DX10 header",
+             _absoluteFilePath.c_str());
+      return false;
+    }
+
+    uint8_t* dx10Header = header + DDS_HEADER_SIZE;
+    _fileStream.read(reinterpret_cast<char*>(dx10Header),
+                     DDS_DX10_HEADER_SIZE);
+    if (DDS_DIMENSION_TEXTURE2D !=
+        ByteReader::readLittleEndian32(header, DDS_HEADER_SIZE + 4)) {
+      LOGERR("Error, file: %s is not a 2D texture",
+             _absoluteFilePath.c_str());
+      return false;
+    }
+
+    const uint32_t miscFlag =
+        ByteReader::readLittleEndian32(header, DDS_HEADER_SIZE + 8);
+    format = ByteReader::readLittleEndian32(header, DDS_HEADER_SIZE);
+    layerCount = std::max(
+        ByteReader::readLittleEndian32(header, DDS_HEADER_SIZE + 12), 1U);
+    if (0 != (miscFlag & DDS_RESOURCE_MISC_TEXTURECUBE)) {
+      layerCount *= CUBE_MAP_FACES;
+    }
+  } else if (0 != (pixelFormatFlags & DDPF_FOURCC)) {
+    for (const auto& fourCcFormat : DDS_FOURCC_FORMATS) {
+      if (0 == memcmp(fourCc, fourCcFormat.fourCc, 4)) {
+        format = fourCcFormat.dxgiFormat;
+        break;
+      }
+    }
+  } else if ((0 != (pixelFormatFlags & DDPF_RGB)) &&
+             (32 == ByteReader::readLittleEndian32(header, 88))) {
+    const uint32_t redMask = ByteReader::readLittleEndian32(header, 92);
+    const uint32_t alphaMask = ByteReader::readLittleEndian32(header, 104);
+    // there is no RGBX format - the alpha channel must be present
+    if ((0x000000FF == redMask) && (0xFF000000 == alphaMask)) {
+      format = DXGI_FORMAT_R8G8B8A8_UNORM;
+    } else if (0x00FF0000 == redMask) {
+      format = (0 != alphaMask) ? DXGI_FORMAT_B8G8R8A8_UNORM
+                                : DXGI_FORMAT_B8G8R8X8_UNORM;
+    }
+  }
+
+  if (0 == format) {
+    LOGERR("Error, file: %s has unsupported legacy pixel format. Re-export "
+           "it with a DX10 header", _absoluteFilePath.c_str());
+    return false;
+  }
+
+  _imageWidth = static_cast<int32_t>(width);
+  _imageHeight = static_cast<int32_t>(height);
+  _imageInfo.container = TextureContainer::DDS;
+  _imageInfo.format = format;
+  _imageInfo.mipCount = ((0 != (flags & DDSD_MIPMAPCOUNT)) &&
+                         (0 != mipMapCount)) ? mipMapCount : 1;
+  _imageInfo.layerCount = layerCount;
+
+  // the texel blocks are stored exactly as they are uploaded
+  _imageInfo.gpuSize = static_cast<uint64_t>(_fileSize - dataPos);
+
+  return true;
+}
+
+bool FileParser::isValidAstcFile() {
+  if (!_fileStream)  // sanity check
+  {
+    LOGERR("Internal error, ifstream for %s not opened",
+           _absoluteFilePath.c_str());
+    return false;
+  }
+
+  if (_fileSize < ASTC_HEADER_SIZE) {
+    LOGERR("Warning, file: %s is too small: %" PRId64" and has incomplete "
+           "astc header", _absoluteFilePath.c_str(), _fileSize);
+    return false;
+  }
+
+  uint8_t header[ASTC_HEADER_SIZE] = {0};
+  _fileStream.seekg(0, std::ifstream::beg);
+  _fileStream.read(reinterpret_cast<char*>(header), ASTC_HEADER_SIZE);
+
+  if (0 != memcmp(header, ASTC_MAGIC, sizeof(ASTC_MAGIC))) {
+    LOGERR("Error, file: %s has no ASTC header", _absoluteFilePath.c_str());
+    return false;
+  }
+
+  const uint32_t blockWidth = header[4];
+  const uint32_t blockHeight = header[5];
+  const uint32_t blockDepth = header[6];
+
+  // the dimensions are 24 bit little endian values
+  const uint32_t width = ByteReader::readLittleEndian24(header, 7);
+  const uint32_t height = ByteReader::readLittleEndian24(header, 10);
+  const uint32_t depth = ByteReader::readLittleEndian24(header, 13);
+
+  uint32_t format = 0;
+  if (1 == blockDepth) {
+    for (size_t i = 0; i < std::size(ASTC_BLOCKS); ++i) {
+      if ((ASTC_BLOCKS[i].width == blockWidth) &&
+          (ASTC_BLOCKS[i].height == blockHeight)) {
+        // the UNORM and SRGB formats of every footprint alternate
+        format = VK_FORMAT_ASTC_4x4_UNORM_BLOCK +
+                 static_cast<uint32_t>(2 * i);
+        break;
+      }
+    }
+  }
+
+  if (0 == format) {
+    LOGERR("Error, file: %s has unsupported block footprint: %ux%ux%u",
+           _absoluteFilePath.c_str(), blockWidth, blockHeight, blockDepth);
+    return false;
+  }
+
+  // 3D textures can not be drawn as images
+  if ((0 == width) || (0 == height) || (1 != depth)) {
+    LOGERR("Error, file: %s is not a 2D texture (%ux%ux%u)",
+           _absoluteFilePath.c_str(), width, height, depth);
+    return false;
+  }
+
+  const uint64_t blocksCount =
+      static_cast<uint64_t>((width + blockWidth - 1) / blockWidth) *
+      ((height + blockHeight - 1) / blockHeight);
+  const uint64_t dataSize = blocksCount * ASTC_BLOCK_SIZE;
+  if (dataSize > static_cast<uint64_t>(_fileSize - ASTC_HEADER_SIZE)) {
+    LOGERR("Error, file: %s has truncated texel data: %" PRId64 " out of %"
+           PRIu64 " bytes", _absoluteFilePath.c_str(),
+           _fileSize - ASTC_HEADER_SIZE, dataSize);
+    return false;
+  }
+
+  _imageWidth = static_cast<int32_t>(width);
+  _imageHeight = static_cast<int32_t>(height);
+  _imageInfo.container = TextureContainer::ASTC;
+  _imageInfo.format = format;
+  _imageInfo.mipCount = 1;
+  _imageInfo.layerCount = 1;
+  _imageInfo.gpuSize = dataSize;
+
+  return true;
+}
+
+bool FileParser::isValidFontFile() {
+  if (!_fileStream)  // sanity check
+  {
+    LOGERR("Internal error, ifstream for %s not opened",
+           _absoluteFilePath.c_str());
+    return false;
+  }
+
+  if (_fileSize < SFNT_HEADER_SIZE) {
+    LOGERR("Warning, file: %s is too small: %" PRId64" and has incomplete "
+           "font header", _absoluteFilePath.c_str(), _fileSize);
+    return false;
+  }
+
+  uint8_t header[TTC_HEADER_SIZE] = {0};
+  _fileStream.seekg(0, std::ifstream::beg);
+  _fileStream.read(reinterpret_cast<char*>(header),
+      std::min<int64_t>(TTC_HEADER_SIZE, _fileSize));
+
+  // font collections - the first font is used
+  int64_t fontOffset = 0;
+  if (0 == memcmp(header, "ttcf", 4)) {
+    fontOffset = ByteReader::readBigEndian32(header, 12);
+    if (fontOffset + SFNT_HEADER_SIZE > _fileSize) {
+      LOGERR("Error, file: %s has invalid font collection header",
+             _absoluteFilePath.c_str());
+      return false;
+    }
+    _fileStream.seekg(fontOffset, std::ifstream::beg);
+    _fileStream.read(reinterpret_cast<char*>(header), SFNT_HEADER_SIZE);
+  }
+
+  const uint32_t sfntVersion = ByteReader::readBigEndian32(header);
+  const bool isValidVersion = (0x00010000 == sfntVersion) ||
+                              (0 == memcmp(header, "OTTO", 4)) ||
+                              (0 == memcmp(header, "true", 4));
+  if (!isValidVersion) {
+    LOGERR("Error, file: %s has no TrueType/OpenType header",
+           _absoluteFilePath.c_str());
+    return false;
+  }
+
+  const int64_t tablesCount = ByteReader::readBigEndian16(header, 4);
+  const int64_t directorySize = tablesCount * SFNT_TABLE_RECORD_SIZE;
+  if (fontOffset + SFNT_HEADER_SIZE + directorySize > _fileSize) {
+    LOGERR("Error, file: %s has truncated table directory",
+           _absoluteFilePath.c_str());
+    return false;
+  }
+
+  std::vector<uint8_t> directory(static_cast<size_t>(directorySize));
+  _fileStream.seekg(fontOffset + SFNT_HEADER_SIZE, std::ifstream::beg);
+  _fileStream.read(reinterpret_cast<char*>(directory.data()), directorySize);
+
+  // reads a whole table, if it's present and has at least minSize bytes
+  auto readTable = [this, &directory, tablesCount](const char* tag,
+      const int64_t minSize, std::vector<uint8_t>& outTable) {
+    for (int64_t i = 0; i < tablesCount; ++i) {
+      const int64_t recordPos = i * SFNT_TABLE_RECORD_SIZE;
+      if (0 != memcmp(directory.data() + recordPos, tag, 4)) {
+        continue;
+      }
+
+      const int64_t offset =
+          ByteReader::readBigEndian32(directory, recordPos + 8);
+      const int64_t length =
+          ByteReader::readBigEndian32(directory, recordPos + 12);
+      if ((length < minSize) || (offset + length > _fileSize)) {
+        return false;
+      }
+
+      outTable.resize(static_cast<size_t>(length));
+      _fileStream.seekg(offset, std::ifstream::beg);
+      _fileStream.read(reinterpret_cast<char*>(outTable.data()), length);
+      return static_cast<bool>(_fileStream);
+    }
+
+    return false;
+  };
+
+  std::vector<uint8_t> head;
+  std::vector<uint8_t> hhea;
+  std::vector<uint8_t> maxp;
+  if (!readTable("head", HEAD_TABLE_MIN_SIZE, head) ||
+      !readTable("hhea", HHEA_TABLE_MIN_SIZE, hhea) ||
+      !readTable("maxp", MAXP_TABLE_MIN_SIZE, maxp)) {
+    LOGERR("Error, file: %s has missing or invalid 'head'/'hhea'/'maxp' "
+           "font tables", _absoluteFilePath.c_str());
+    _fileStream.clear();
+    return false;
+  }
+
+  _fontInfo.unitsPerEm = ByteReader::readBigEndian16(head, 18);
+  _fontInfo.ascent = ByteReader::readBigEndianSigned16(hhea, 4);
+  _fontInfo.descent = ByteReader::readBigEndianSigned16(hhea, 6);
+  _fontInfo.lineGap = ByteReader::readBigEndianSigned16(hhea, 8);
+  _fontInfo.advanceWidthMax = ByteReader::readBigEndian16(hhea, 10);
+  _fontInfo.glyphCount = ByteReader::readBigEndian16(maxp, 4);
+
+  // OS/2 table is optional (e.g. for Apple TrueType fonts)
+  std::vector<uint8_t> os2;
+  if (readTable("OS/2", OS2_TABLE_MIN_SIZE, os2)) {
+    _fontInfo.avgCharWidth = static_cast<uint32_t>(
+        std::max<int16_t>(0, ByteReader::readBigEndianSigned16(os2, 2)));
+  }
+  _fileStream.clear();
+
+  if (0 == _fontInfo.unitsPerEm) {
+    LOGERR("Error, file: %s has invalid unitsPerEm",
+           _absoluteFilePath.c_str());
+    _fontInfo = FontInfo();
+    return false;
+  }
+
+  return true;
+}
+
+bool FileParser::isValidWavFile() {
+  if (!_fileStream)  // sanity check
+  {
+    LOGERR("Internal error, ifstream for %s not opened",
+           _absoluteFilePath.c_str());
+    return false;
+  }
+
+  if (_fileSize < RIFF_HEADER_SIZE) {
+    LOGERR("Warning, file: %s is too small: %" PRId64" and has incomplete "
+           "wav header", _absoluteFilePath.c_str(), _fileSize);
+    return false;
+  }
+
+  uint8_t riffHeader[RIFF_HEADER_SIZE] = {0};
+  _fileStream.seekg(0, std::ifstream::beg);
+  _fileStream.read(reinterpret_cast<char*>(riffHeader), RIFF_HEADER_SIZE);
+
+  if ((0 != memcmp(riffHeader, "RIFF", 4)) ||
+      (0 != memcmp(riffHeader + 8, "WAVE", 4))) {
+    LOGERR("Error, file: %s has no RIFF/WAVE header",
+           _absoluteFilePath.c_str());
+    return false;
+  }
+
+  bool fmtFound = false;
+  bool dataFound = false;
+  uint16_t audioFormat = 0;
+  uint16_t blockAlign = 0;
+  uint64_t dataSize = 0;
+  uint64_t factSamples = 0;
+
+  int64_t pos = RIFF_HEADER_SIZE;
+  uint8_t chunkHeader[RIFF_CHUNK_HEADER_SIZE] = {0};
+  while (pos + RIFF_CHUNK_HEADER_SIZE <= _fileSize) {
+    _fileStream.seekg(pos, std::ifstream::beg);
+    _fileStream.read(reinterpret_cast<char*>(chunkHeader),
+                     RIFF_CHUNK_HEADER_SIZE);
+    const int64_t chunkSize =
+        static_cast<int64_t>(ByteReader::readLittleEndian32(chunkHeader, 4));
+    const int64_t chunkDataPos = pos + RIFF_CHUNK_HEADER_SIZE;
+
+    if (0 == memcmp(chunkHeader, "fmt ", 4)) {
+      if ((WAV_FMT_MIN_SIZE > chunkSize) ||
+          (chunkDataPos + WAV_FMT_MIN_SIZE > _fileSize)) {
+        break;
+      }
+
+      uint8_t fmt[WAV_FMT_MIN_SIZE] = {0};
+      _fileStream.read(reinterpret_cast<char*>(fmt), WAV_FMT_MIN_SIZE);
+
+      audioFormat = ByteReader::readLittleEndian16(fmt);
+      _soundInfo.channels = ByteReader::readLittleEndian16(fmt, 2);
+      _soundInfo.sampleRate = ByteReader::readLittleEndian32(fmt, 4);
+      blockAlign = ByteReader::readLittleEndian16(fmt, 12);
+      _soundInfo.bitsPerSample = ByteReader::readLittleEndian16(fmt, 14);
+      fmtFound = true;
+    } else if (0 == memcmp(chunkHeader, "fact", 4)) {
+      constexpr int64_t FACT_SIZE = sizeof(uint32_t);
+      if ((FACT_SIZE > chunkSize) || (chunkDataPos + FACT_SIZE > _fileSize)) {
+        break;
+      }
+
+      uint8_t fact[FACT_SIZE] = {0};
+      _fileStream.read(reinterpret_cast<char*>(fact), sizeof(fact));
+      factSamples = ByteReader::readLittleEndian32(fact);
+    } else if (0 == memcmp(chunkHeader, "data", 4)) {
+      // the data chunk may be truncated or have an unknown size
+      dataSize = static_cast<uint64_t>(
+          std::min(chunkSize, _fileSize - chunkDataPos));
+      dataFound = true;
+    }
+
+    if (fmtFound && dataFound) {
+      break;
+    }
+
+    // chunks are word aligned
+    pos = chunkDataPos + chunkSize + (chunkSize & 1);
+  }
+
+  if (!fmtFound || !dataFound || (0 == blockAlign) ||
+      (0 == _soundInfo.channels) || (0 == _soundInfo.sampleRate)) {
+    LOGERR("Error, file: %s has missing or invalid 'fmt '/'data' chunks",
+           _absoluteFilePath.c_str());
+    _soundInfo = SoundInfo();
+    return false;
+  }
+
+  const bool isPcm = (WAV_FORMAT_PCM == audioFormat) ||
+                     (WAV_FORMAT_IEEE_FLOAT == audioFormat) ||
+                     (WAV_FORMAT_EXTENSIBLE == audioFormat);
+  if (isPcm) {
+    _soundInfo.totalSamples = dataSize / blockAlign;
+  } else {
+    // compressed wav formats carry the sample count in the 'fact' chunk
+    _soundInfo.totalSamples = factSamples;
+    _soundInfo.bitsPerSample = 0;
+  }
+
+  return true;
+}
+
+bool FileParser::isValidOggFile() {
+  if (!_fileStream)  // sanity check
+  {
+    LOGERR("Internal error, ifstream for %s not opened",
+           _absoluteFilePath.c_str());
+    return false;
+  }
+
+  if (_fileSize < OGG_PAGE_HEADER_SIZE) {
+    LOGERR("Warning, file: %s is too small: %" PRId64" and has incomplete "
+           "ogg header", _absoluteFilePath.c_str(), _fileSize);
+    return false;
+  }
+
+  uint8_t pageHeader[OGG_PAGE_HEADER_SIZE] = {0};
+  _fileStream.seekg(0, std::ifstream::beg);
+  _fileStream.read(reinterpret_cast<char*>(pageHeader), OGG_PAGE_HEADER_SIZE);
+
+  if (0 != memcmp(pageHeader, "OggS", 4)) {
+    LOGERR("Error, file: %s has no Ogg page header",
+           _absoluteFilePath.c_str());
+    return false;
+  }
+
+  // the identification packet follows the segment table of the first page
+  const int64_t segmentsCount = pageHeader[OGG_PAGE_HEADER_SIZE - 1];
+  const int64_t packetPos = OGG_PAGE_HEADER_SIZE + segmentsCount;
+  if (packetPos + VORBIS_ID_HEADER_SIZE > _fileSize) {
+    LOGERR("Warning, file: %s has incomplete ogg identification header",
+           _absoluteFilePath.c_str());
+    return false;
+  }
+
+  uint8_t idHeader[VORBIS_ID_HEADER_SIZE] = {0};
+  _fileStream.seekg(packetPos, std::ifstream::beg);
+  _fileStream.read(reinterpret_cast<char*>(idHeader), VORBIS_ID_HEADER_SIZE);
+
+  if ((0x01 != idHeader[0]) || (0 != memcmp(idHeader + 1, "vorbis", 6))) {
+    // still a valid Ogg container (e.g. Opus), the runtime has to decode it
+    LOGR("Warning, file: %s is not an Ogg Vorbis stream. Sound parameters "
+         "will not be provided", _absoluteFilePath.c_str());
+    return true;
+  }
+
+  _soundInfo.channels = idHeader[11];
+  _soundInfo.sampleRate = ByteReader::readLittleEndian32(idHeader, 12);
+
+  // the granule position of the last page holds the total samples count
+  const int64_t searchSize = std::min(_fileSize, OGG_MAX_PAGE_SIZE);
+  std::vector<uint8_t> tail(static_cast<size_t>(searchSize));
+  _fileStream.seekg(_fileSize - searchSize, std::ifstream::beg);
+  _fileStream.read(reinterpret_cast<char*>(tail.data()), searchSize);
+
+  // prefer the end of stream page, fall back to the last complete page
+  // for streams, which were cut without one
+  const uint32_t serial =
+      ByteReader::readLittleEndian32(pageHeader, OGG_SERIAL_OFFSET);
+  bool granuleFound = false;
+  // the capture pattern may as well occur inside of the compressed packet
+  // data - a page is accepted only if it is complete, belongs to the
+  // stream and it's CRC matches
+  OggPageInfo page;
+  for (int64_t i = searchSize - OGG_PAGE_HEADER_SIZE; i >= 0; --i) {
+    const auto pageData =
+        std::span<const uint8_t>(tail).subspan(static_cast<size_t>(i));
+    if ((OggPageStatus::VALID != OggPage::read(pageData, page)) ||
+        (serial != page.serial)) {
+      continue;
+    }
+
+    // pages without a finished packet carry no granule position
+    if (OggPageInfo::UNKNOWN_GRANULE == page.granule) {
+      continue;
+    }
+
+    if (0 != (page.headerType & OggPageInfo::EOS_FLAG)) {
+      _soundInfo.totalSamples = page.granule;
+      break;
+    }
+
+    if (!granuleFound) {
+      _soundInfo.totalSamples = page.granule;
+      granuleFound = true;
+    }
+  }
+
+  return true;
+}
+
 bool FileParser::isValidSpriteDescription(
     ResourceDefines::SpriteLayout& outLayout) {
   bool success = true;
@@ -0,0 +1,323 @@
+// Corresponding header
+#include "resource_builder/GlyphAtlasBuilder.h"
+
+// System headers
+#include <algorithm>
+#include <cmath>
+#include <filesystem>
+#include <iomanip>
+#include <numeric>
+#include <sstream>
+#include <system_error>
+
+// Other libraries headers
+#include "utils/log/Log.h"
+
+// Own components headers
+#include "resource_builder/AtomicFileStream.h"
+#include "resource_builder/BuilderStructs.h"
+#include "resource_builder/PngCodec.h"
+#include "resource_builder/TrueTypeFont.h"
+
+namespace {
+constexpr auto MAX_UINT64_T_HEX_LENGTH = 16;
+constexpr auto ATLASES_FOLDER_NAME = "font_atlases";
+constexpr auto ATLAS_IMAGE_EXTENSION = ".png";
+constexpr auto ATLAS_METRICS_EXTENSION = ".bin";
+constexpr auto FLOAT_ROUND_TRIP_DIGITS = 9;
+constexpr uint32_t GLYPH_PADDING = 1;
+constexpr uint32_t MIN_ATLAS_DIMENSION = 32;
+constexpr uint32_t MAX_ATLAS_DIMENSION = 16384;
+constexpr uint8_t GLYPH_COLOR = 255;
+
+struct AtlasGlyph {
+  uint32_t codepoint = 0;
+  GlyphBitmap bitmap;
+  uint32_t x = 0;
+  uint32_t y = 0;
+};
+
+/** @brief used to place the glyphs on horizontal shelves (in the
+ *         provided order) inside an atlas with the provided dimensions.
+ *
+ *  @returns bool - do all the glyphs fit or not
+ * */
+bool packShelves(const std::vector<size_t>& order, const uint32_t width,
+                 const uint32_t height, std::vector<AtlasGlyph>& glyphs) {
+  uint32_t x = GLYPH_PADDING;
+  uint32_t y = GLYPH_PADDING;
+  uint32_t shelfHeight = 0;
+
+  for (const size_t idx : order) {
+    AtlasGlyph& glyph = glyphs[idx];
+    if (0 == glyph.bitmap.width) {
+      continue;
+    }
+
+    if ((x + glyph.bitmap.width + GLYPH_PADDING) > width) {
+      y += shelfHeight + GLYPH_PADDING;
+      x = GLYPH_PADDING;
+      shelfHeight = 0;
+    }
+
+    if (((glyph.bitmap.width + (2 * GLYPH_PADDING)) > width) ||
+        ((y + glyph.bitmap.height + GLYPH_PADDING) > height)) {
+      return false;
+    }
+
+    glyph.x = x;
+    glyph.y = y;
+    x += glyph.bitmap.width + GLYPH_PADDING;
+    shelfHeight = std::max(shelfHeight, glyph.bitmap.height);
+  }
+
+  return true;
+}
+
+void writeAtlasMetrics(AtomicFileStream& stream,
+                       const std::vector<AtlasGlyph>& glyphs,
+                       const RgbaImage& atlas, const int32_t lineHeight) {
+  const float width = static_cast<float>(atlas.width);
+  const float height = static_cast<float>(atlas.height);
+
+  stream << "#glyphs: " << glyphs.size() << '\n'
+         << "#atlas: " << atlas.width << ' ' << atlas.height << '\n'
+         << "#line height: " << lineHeight << '\n'
+         << std::setprecision(FLOAT_ROUND_TRIP_DIGITS);
+
+  for (const AtlasGlyph& glyph : glyphs) {
+    const GlyphBitmap& bitmap = glyph.bitmap;
+    const float uvs[] = {
+        static_cast<float>(glyph.x) / width,
+        static_cast<float>(glyph.y) / height,
+        static_cast<float>(glyph.x + bitmap.width) / width,
+        static_cast<float>(glyph.y + bitmap.height) / height };
+
+    stream << glyph.codepoint << ' ' << bitmap.advance << ' '
+           << bitmap.bearingX << ' ' << bitmap.bearingY << ' '
+           << bitmap.width << ' ' << bitmap.height << ' ' << glyph.x << ' '
+           << glyph.y;
+    for (const float uv : uvs) {
+      stream << ' ' << uv;
+    }
+    stream << '\n';
+  }
+}
+}
+
+void GlyphAtlasBuilder::init(const std::vector<CodepointRange>& charset) {
+  _charset = charset;
+}
+
+ErrorCode GlyphAtlasBuilder::writeData(
+    const std::string& destDir, const std::vector<BuilderCombinedData>& data,
+    const bool syncToDisk) {
+  _atlasNames.clear();
+
+  const std::filesystem::path atlasesDir =
+      std::filesystem::path(destDir) / ATLASES_FOLDER_NAME;
+  std::error_code errorCode;
+  std::ostringstream hashStream;
+
+  for (const auto& entry : data) {
+    if ("font" != entry.type) {
+      continue;
+    }
+
+    std::filesystem::create_directories(atlasesDir, errorCode);
+    if (errorCode) {
+      LOGERR("Error, could not create directory: %s, reason: %s",
+             atlasesDir.string().c_str(), errorCode.message().c_str());
+      return ErrorCode::FAILURE;
+    }
+
+    hashStream.str("");
+    hashStream << "0x" << std::hex << std::uppercase
+               << std::setw(MAX_UINT64_T_HEX_LENGTH) << std::setfill('0')
+               << entry.header.hashValue;
+    const std::string atlasName =
+        (std::filesystem::path(ATLASES_FOLDER_NAME) / hashStream.str())
+            .generic_string();
+
+    TrueTypeFont font;
+    if (ErrorCode::SUCCESS != font.load(entry.absoluteFilePath)) {
+      LOGR("Warning, font: %s can not be rasterized offline. It will be "
+           "rasterized at runtime", entry.header.path.c_str());
+      continue;
+    }
+
+    const std::string fileName =
+        (atlasesDir / hashStream.str()).string();
+    if (ErrorCode::SUCCESS != buildAtlas(entry, font, fileName, syncToDisk)) {
+      LOGERR("Error, buildAtlas() failed for font: %s",
+             entry.header.path.c_str());
+      return ErrorCode::FAILURE;
+    }
+
+    _atlasNames.emplace(entry.header.hashValue, atlasName);
+  }
+
+  return ErrorCode::SUCCESS;
+}
+
+bool GlyphAtlasBuilder::getAtlasName(const uint64_t hashValue,
+                                     std::string& outName) const {
+  const auto it = _atlasNames.find(hashValue);
+  if (_atlasNames.end() == it) {
+    return false;
+  }
+
+  outName = it->second;
+  return true;
+}
+
+void GlyphAtlasBuilder::removeStaleAtlases(const std::string& destDir) const {
+  const std::filesystem::path atlasesDir =
+      std::filesystem::path(destDir) / ATLASES_FOLDER_NAME;
+
+  std::error_code errorCode;
+  if (!std::filesystem::is_directory(atlasesDir, errorCode)) {
+    return;
+  }
+
+  for (const auto& dirEntry :
+       std::filesystem::directory_iterator(atlasesDir, errorCode)) {
+    const std::filesystem::path& path = dirEntry.path();
+    const std::string extension = path.extension().string();
+    if ((ATLAS_IMAGE_EXTENSION != extension) &&
+        (ATLAS_METRICS_EXTENSION != extension)) {
+      continue;
+    }
+
+    const std::string name =
+        (std::filesystem::path(ATLASES_FOLDER_NAME) / path.stem())
+            .generic_string();
+    const bool isReferenced = std::any_of(_atlasNames.begin(),
+        _atlasNames.end(), [&name](const auto& atlas) {
+          return atlas.second == name;
+        });
+    if (!isReferenced) {
+      std::filesystem::remove(path, errorCode);
+    }
+  }
+}
+
+void GlyphAtlasBuilder::reset() {
+  _atlasNames.clear();
+}
+
+ErrorCode GlyphAtlasBuilder::buildAtlas(const BuilderCombinedData& entry,
+                                        const TrueTypeFont& font,
+                                        const std::string& fileName,
+                                        const bool syncToDisk) const {
+  const float scale = font.getScale(entry.fontSize);
+
+  std::vector<AtlasGlyph> glyphs;
+  for (const CodepointRange& range : _charset) {
+    for (uint64_t codepoint = range.first; codepoint <= range.last;
+         ++codepoint) {
+      AtlasGlyph glyph;
+      glyph.codepoint = static_cast<uint32_t>(codepoint);
+
+      // codepoints, which are not covered by the font are skipped
+      const uint32_t glyphIdx = font.findGlyphIndex(glyph.codepoint);
+      if (0 == glyphIdx) {
+        continue;
+      }
+
+      if (ErrorCode::SUCCESS !=
+          font.rasterizeGlyph(glyphIdx, scale, glyph.bitmap)) {
+        LOGERR("Error, rasterizeGlyph() failed for codepoint: %u",
+               glyph.codepoint);
+        return ErrorCode::FAILURE;
+      }
+      glyphs.push_back(std::move(glyph));
+    }
+  }
+
+  // tallest glyphs first produce the tightest shelves
+  std::vector<size_t> order(glyphs.size());
+  std::iota(order.begin(), order.end(), 0);
+  std::stable_sort(order.begin(), order.end(),
+      [&glyphs](const size_t lhs, const size_t rhs) {
+        return glyphs[lhs].bitmap.height > glyphs[rhs].bitmap.height;
+      });
+
+  RgbaImage atlas;
+  atlas.width = MIN_ATLAS_DIMENSION;
+  atlas.height = MIN_ATLAS_DIMENSION;
+  while (!packShelves(order, atlas.width, atlas.height, glyphs)) {
+    // grow the shorter side to keep the atlas close to a square
+    if (atlas.width <= atlas.height) {
+      atlas.width *= 2;
+    } else {
+      atlas.height *= 2;
+    }
+
+    if (MAX_ATLAS_DIMENSION < std::max(atlas.width, atlas.height)) {
+      LOGERR("Error, glyphs of font: %s do not fit in a %ux%u atlas",
+             entry.header.path.c_str(), MAX_ATLAS_DIMENSION,
+             MAX_ATLAS_DIMENSION);
+      return ErrorCode::FAILURE;
+    }
+  }
+
+  atlas.pixels.assign(static_cast<size_t>(atlas.width) * atlas.height *
+                      RgbaImage::CHANNELS, 0);
+  for (const AtlasGlyph& glyph : glyphs) {
+    const GlyphBitmap& bitmap = glyph.bitmap;
+    for (uint32_t row = 0; row < bitmap.height; ++row) {
+      for (uint32_t col = 0; col < bitmap.width; ++col) {
+        const size_t pixel = ((static_cast<size_t>(glyph.y + row) *
+                               atlas.width) + glyph.x + col) *
+                             RgbaImage::CHANNELS;
+        atlas.pixels[pixel] = GLYPH_COLOR;
+        atlas.pixels[pixel + 1] = GLYPH_COLOR;
+        atlas.pixels[pixel + 2] = GLYPH_COLOR;
+        atlas.pixels[pixel + 3] =
+            bitmap.coverage[(static_cast<size_t>(row) * bitmap.width) + col];
+      }
+    }
+  }
+
+  std::vector<uint8_t> pngData;
+  if (ErrorCode::SUCCESS != PngCodec::encode(atlas, pngData)) {
+    LOGERR("Error in PngCodec::encode()");
+    return ErrorCode::FAILURE;
+  }
+
+  AtomicFileStream imageStream;
+  if (ErrorCode::SUCCESS !=
+      imageStream.begin(fileName + ATLAS_IMAGE_EXTENSION)) {
+    LOGERR("Error in imageStream.begin()");
+    return ErrorCode::FAILURE;
+  }
+  imageStream.write(reinterpret_cast<const char*>(pngData.data()),
+                    static_cast<std::streamsize>(pngData.size()));
+
+  const FontInfo& info = entry.fontInfo;
+  const int32_t lineHeight = static_cast<int32_t>(std::lround(
+      static_cast<float>(info.ascent - info.descent + info.lineGap) * scale));
+
+  AtomicFileStream metricsStream;
+  if (ErrorCode::SUCCESS !=
+      metricsStream.begin(fileName + ATLAS_METRICS_EXTENSION)) {
+    LOGERR("Error in metricsStream.begin()");
+    return ErrorCode::FAILURE;
+  }
+  writeAtlasMetrics(metricsStream, glyphs, atlas, lineHeight);
+
+  // the metrics table is published last - it references the image
+  if ((ErrorCode::SUCCESS != imageStream.publish(syncToDisk)) ||
+      (ErrorCode::SUCCESS != metricsStream.publish(syncToDisk))) {
+    LOGERR("Error, could not publish atlas: %s", fileName.c_str());
+    return ErrorCode::FAILURE;
+  }
+
+  LOG_ON_SAME_LINE("%s glyph atlas generation ... (%zu glyphs in %ux%u) ",
+                   entry.header.path.c_str(), glyphs.size(), atlas.width,
+                   atlas.height);
+  LOGG("[Done]");
+
+  return ErrorCode::SUCCESS;
+}
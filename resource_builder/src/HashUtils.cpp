@@ -0,0 +1,444 @@
+// Corresponding header
+#include "resource_builder/HashUtils.h"
+
+// System headers
+#include <array>
+#include <cstring>
+#include <span>
+
+#if defined(__x86_64__) && (defined(__GNUC__) || defined(__clang__))
+  #define CRC32_PCLMUL_SUPPORTED
+  #define HASH_AVX2_SUPPORTED
+  #include <immintrin.h>
+#endif
+
+// Other libraries headers
+
+// Own components headers
+#include "resource_builder/ByteReader.h"
+
+namespace {
+constexpr uint64_t FNV_OFFSET_BASIS = 0xCBF29CE484222325ULL;
+constexpr uint64_t FNV_PRIME = 0x00000100000001B3ULL;
+
+constexpr uint64_t XXH_PRIME64_1 = 0x9E3779B185EBCA87ULL;
+constexpr uint64_t XXH_PRIME64_2 = 0xC2B2AE3D27D4EB4FULL;
+constexpr uint64_t XXH_PRIME64_3 = 0x165667B19E3779F9ULL;
+constexpr uint64_t XXH_PRIME64_4 = 0x85EBCA77C2B2AE63ULL;
+constexpr uint64_t XXH_PRIME64_5 = 0x27D4EB2F165667C5ULL;
+constexpr size_t XXH_STRIPE_SIZE = 32;
+constexpr uint64_t XXH_PRIME32_1 = 0x9E3779B1ULL;
+constexpr uint64_t XXH_PRIME32_2 = 0x85EBCA77ULL;
+constexpr uint64_t XXH_PRIME32_3 = 0xC2B2AE3DULL;
+
+constexpr size_t WIDE_LANES_COUNT = 8;
+constexpr size_t WIDE_STRIPE_SIZE = WIDE_LANES_COUNT * sizeof(uint64_t);
+constexpr size_t WIDE_STRIPES_PER_SCRAMBLE = 16;
+constexpr uint32_t WIDE_SCRAMBLE_SHIFT = 47;
+
+using WideLanes = std::array<uint64_t, WIDE_LANES_COUNT>;
+
+// initial lanes and keys of the XXH3 long input accumulation
+constexpr WideLanes WIDE_INITIAL_LANES = {
+    XXH_PRIME32_3, XXH_PRIME64_1, XXH_PRIME64_2, XXH_PRIME64_3,
+    XXH_PRIME64_4, XXH_PRIME32_2, XXH_PRIME64_5, XXH_PRIME32_1 };
+constexpr WideLanes WIDE_KEYS = {
+    0xBE4BA423396CFEB8ULL, 0x1CAD21F72C81017CULL, 0xDB979083E96DD4DEULL,
+    0x1F67B3B7A4A44072ULL, 0x78E5C0CC4EE679CBULL, 0x2172FFCC7DD05A82ULL,
+    0x8E2443F7744608B8ULL, 0x4C263A81E69035E0ULL };
+
+// reflected CRC-32 polynomial
+constexpr uint32_t CRC32_POLYNOMIAL = 0xEDB88320U;
+
+constexpr std::array<uint32_t, 256> createCrc32Table() {
+  std::array<uint32_t, 256> table{};
+  for (uint32_t i = 0; i < table.size(); ++i) {
+    uint32_t crc = i;
+    for (uint32_t bit = 0; bit < 8; ++bit) {
+      crc = (crc & 1U) ? ((crc >> 1) ^ CRC32_POLYNOMIAL) : (crc >> 1);
+    }
+    table[i] = crc;
+  }
+
+  return table;
+}
+
+constexpr std::array<uint32_t, 256> CRC32_TABLE = createCrc32Table();
+
+// non reflected (MSB first) CRC-32 polynomial of the Ogg pages
+constexpr uint32_t CRC32_OGG_POLYNOMIAL = 0x04C11DB7U;
+
+constexpr std::array<uint32_t, 256> createCrc32OggTable() {
+  std::array<uint32_t, 256> table{};
+  for (uint32_t i = 0; i < table.size(); ++i) {
+    uint32_t crc = i << 24;
+    for (uint32_t bit = 0; bit < 8; ++bit) {
+      crc = (crc & 0x80000000U) ? ((crc << 1) ^ CRC32_OGG_POLYNOMIAL)
+                                : (crc << 1);
+    }
+    table[i] = crc;
+  }
+
+  return table;
+}
+
+constexpr std::array<uint32_t, 256> CRC32_OGG_TABLE = createCrc32OggTable();
+
+uint32_t crc32Table(const uint8_t* data, const size_t size, uint32_t crc) {
+  for (size_t i = 0; i < size; ++i) {
+    crc = CRC32_TABLE[(crc ^ data[i]) & 0xFFU] ^ (crc >> 8);
+  }
+
+  return crc;
+}
+
+#ifdef CRC32_PCLMUL_SUPPORTED
+constexpr size_t PCLMUL_BLOCK_SIZE = 16;
+constexpr size_t PCLMUL_FOLD_SIZE = 4 * PCLMUL_BLOCK_SIZE;
+
+/* Folding constants of the reflected polynomial:
+ *      > R1 = x^(4*128+32) mod P, R2 = x^(4*128-32) mod P (fold by 4);
+ *      > R3 = x^(128+32) mod P, R4 = x^(128-32) mod P (fold by 1);
+ *      > R5 = x^64 mod P (fold 64 to 32 bits);
+ *      > P' and u' - the polynomial and the Barrett reduction constant;
+ * */
+constexpr uint64_t CRC32_R1 = 0x154442BD4ULL;
+constexpr uint64_t CRC32_R2 = 0x1C6E41596ULL;
+constexpr uint64_t CRC32_R3 = 0x1751997D0ULL;
+constexpr uint64_t CRC32_R4 = 0x0CCAA009EULL;
+constexpr uint64_t CRC32_R5 = 0x163CD6124ULL;
+constexpr uint64_t CRC32_POLYNOMIAL_P = 0x1DB710641ULL;
+constexpr uint64_t CRC32_BARRETT_U = 0x1F7011641ULL;
+
+bool hasPclmul() {
+  static const bool supported = __builtin_cpu_supports("pclmul") &&
+                                __builtin_cpu_supports("sse4.1");
+  return supported;
+}
+
+__m128i makeConstants(const uint64_t low, const uint64_t high) {
+  return _mm_set_epi64x(static_cast<long long>(high),
+                        static_cast<long long>(low));
+}
+
+__attribute__((target("pclmul,sse4.1")))
+__m128i fold(const __m128i value, const __m128i constants,
+             const __m128i next) {
+  const __m128i low = _mm_clmulepi64_si128(value, constants, 0x00);
+  const __m128i high = _mm_clmulepi64_si128(value, constants, 0x11);
+  return _mm_xor_si128(_mm_xor_si128(low, high), next);
+}
+
+__m128i loadBlock(const uint8_t* data) {
+  return _mm_loadu_si128(reinterpret_cast<const __m128i*>(data));
+}
+
+/** @brief used to fold the data with carry-less multiplications
+ *         (Intel "Fast CRC Computation for Generic Polynomials Using
+ *         PCLMULQDQ Instruction") and reduce it with Barrett reduction
+ *
+ *  @param const uint8_t * - input data
+ *  @param size_t          - input data size. At least PCLMUL_FOLD_SIZE
+ *                           and a multiple of PCLMUL_BLOCK_SIZE
+ *  @param uint32_t        - CRC register (not inverted)
+ *
+ *  @returns uint32_t      - CRC register (not inverted)
+ * */
+__attribute__((target("pclmul,sse4.1")))
+uint32_t crc32Pclmul(const uint8_t* data, size_t size, const uint32_t crc) {
+  __m128i x1 = _mm_xor_si128(loadBlock(data),
+                             _mm_cvtsi32_si128(static_cast<int32_t>(crc)));
+  __m128i x2 = loadBlock(data + PCLMUL_BLOCK_SIZE);
+  __m128i x3 = loadBlock(data + (2 * PCLMUL_BLOCK_SIZE));
+  __m128i x4 = loadBlock(data + (3 * PCLMUL_BLOCK_SIZE));
+  data += PCLMUL_FOLD_SIZE;
+  size -= PCLMUL_FOLD_SIZE;
+
+  // 4 independent folds per iteration keep the multipliers busy
+  const __m128i r2r1 = makeConstants(CRC32_R1, CRC32_R2);
+  for (; PCLMUL_FOLD_SIZE <= size; size -= PCLMUL_FOLD_SIZE) {
+    x1 = fold(x1, r2r1, loadBlock(data));
+    x2 = fold(x2, r2r1, loadBlock(data + PCLMUL_BLOCK_SIZE));
+    x3 = fold(x3, r2r1, loadBlock(data + (2 * PCLMUL_BLOCK_SIZE)));
+    x4 = fold(x4, r2r1, loadBlock(data + (3 * PCLMUL_BLOCK_SIZE)));
+    data += PCLMUL_FOLD_SIZE;
+  }
+
+  const __m128i r4r3 = makeConstants(CRC32_R3, CRC32_R4);
+  x1 = fold(x1, r4r3, x2);
+  x1 = fold(x1, r4r3, x3);
+  x1 = fold(x1, r4r3, x4);
+  for (; PCLMUL_BLOCK_SIZE <= size; size -= PCLMUL_BLOCK_SIZE) {
+    x1 = fold(x1, r4r3, loadBlock(data));
+    data += PCLMUL_BLOCK_SIZE;
+  }
+
+  // 128 to 64 bits (appends 32 zero bits to the message)
+  x1 = _mm_xor_si128(_mm_clmulepi64_si128(r4r3, x1, 0x01),
+                     _mm_srli_si128(x1, 8));
+
+  // 64 to 32 bits
+  const __m128i mask32 = _mm_setr_epi32(-1, 0, 0, 0);
+  const __m128i r5 = makeConstants(CRC32_R5, 0);
+  x1 = _mm_xor_si128(
+      _mm_clmulepi64_si128(_mm_and_si128(x1, mask32), r5, 0x00),
+      _mm_srli_si128(x1, 4));
+
+  // bit reflected Barrett reduction
+  const __m128i poly = makeConstants(CRC32_POLYNOMIAL_P, CRC32_BARRETT_U);
+  __m128i x2Reduced =
+      _mm_clmulepi64_si128(_mm_and_si128(x1, mask32), poly, 0x10);
+  x2Reduced =
+      _mm_clmulepi64_si128(_mm_and_si128(x2Reduced, mask32), poly, 0x00);
+  x1 = _mm_xor_si128(x1, x2Reduced);
+
+  return static_cast<uint32_t>(_mm_extract_epi32(x1, 1));
+}
+#endif
+
+constexpr uint64_t rotateLeft(const uint64_t value, const uint32_t bits) {
+  return (value << bits) | (value >> (64 - bits));
+}
+
+constexpr uint64_t xxhRound(uint64_t accumulator, const uint64_t input) {
+  accumulator += input * XXH_PRIME64_2;
+  accumulator = rotateLeft(accumulator, 31);
+  return accumulator * XXH_PRIME64_1;
+}
+
+constexpr uint64_t xxhMergeRound(uint64_t accumulator, const uint64_t value) {
+  accumulator ^= xxhRound(0, value);
+  return (accumulator * XXH_PRIME64_1) + XXH_PRIME64_4;
+}
+
+constexpr uint64_t xxhAvalanche(uint64_t hashValue) {
+  hashValue ^= hashValue >> 33;
+  hashValue *= XXH_PRIME64_2;
+  hashValue ^= hashValue >> 29;
+  hashValue *= XXH_PRIME64_3;
+  hashValue ^= hashValue >> 32;
+  return hashValue;
+}
+
+/** @brief used to accumulate 64 byte stripes into the lanes. Every lane
+ *         adds the 32x32 bit product of the halves of it's keyed input
+ *         and the raw input of the neighbour lane. The lanes are
+ *         scrambled after every WIDE_STRIPES_PER_SCRAMBLE stripes.
+ *
+ *  @param WideLanes &       - lanes
+ *  @param const WideLanes & - keys
+ *  @param const uint8_t *   - input stripes
+ *  @param size_t            - stripes count
+ * */
+void hashStripes(WideLanes& lanes, const WideLanes& keys,
+                 const uint8_t* data, const size_t stripesCount) {
+  for (size_t stripe = 1; stripe <= stripesCount; ++stripe) {
+    const std::span<const uint8_t> stripeData(data, WIDE_STRIPE_SIZE);
+    for (size_t i = 0; i < WIDE_LANES_COUNT; ++i) {
+      const uint64_t input =
+          ByteReader::readLittleEndian64(stripeData, i * sizeof(uint64_t));
+      const uint64_t keyed = input ^ keys[i];
+      lanes[i ^ 1] += input;
+      lanes[i] += (keyed & 0xFFFFFFFFULL) * (keyed >> 32);
+    }
+    data += WIDE_STRIPE_SIZE;
+
+    if (0 == (stripe % WIDE_STRIPES_PER_SCRAMBLE)) {
+      for (size_t i = 0; i < WIDE_LANES_COUNT; ++i) {
+        lanes[i] ^= lanes[i] >> WIDE_SCRAMBLE_SHIFT;
+        lanes[i] ^= keys[i];
+        lanes[i] *= XXH_PRIME32_1;
+      }
+    }
+  }
+}
+
+#ifdef HASH_AVX2_SUPPORTED
+constexpr size_t AVX2_LANES_COUNT = sizeof(__m256i) / sizeof(uint64_t);
+constexpr size_t AVX2_REGISTERS_COUNT = WIDE_LANES_COUNT / AVX2_LANES_COUNT;
+
+bool hasAvx2() {
+  static const bool supported = __builtin_cpu_supports("avx2");
+  return supported;
+}
+
+/** @brief AVX2 variant of hashStripes(), which produces identical lanes.
+ *         Every register holds 4 lanes, so a stripe takes 2 registers.
+ * */
+__attribute__((target("avx2")))
+void hashStripesAvx2(WideLanes& lanes, const WideLanes& keys,
+                     const uint8_t* data, const size_t stripesCount) {
+  __m256i acc[AVX2_REGISTERS_COUNT];
+  __m256i key[AVX2_REGISTERS_COUNT];
+  for (size_t reg = 0; reg < AVX2_REGISTERS_COUNT; ++reg) {
+    acc[reg] = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(
+        lanes.data() + (reg * AVX2_LANES_COUNT)));
+    key[reg] = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(
+        keys.data() + (reg * AVX2_LANES_COUNT)));
+  }
+  const __m256i prime =
+      _mm256_set1_epi64x(static_cast<long long>(XXH_PRIME32_1));
+
+  for (size_t stripe = 1; stripe <= stripesCount; ++stripe) {
+    for (size_t reg = 0; reg < AVX2_REGISTERS_COUNT; ++reg) {
+      const __m256i input = _mm256_loadu_si256(
+          reinterpret_cast<const __m256i*>(data + (reg * sizeof(__m256i))));
+      const __m256i keyed = _mm256_xor_si256(input, key[reg]);
+      const __m256i product =
+          _mm256_mul_epu32(keyed, _mm256_srli_epi64(keyed, 32));
+      // swaps the neighbour lanes (i ^ 1)
+      const __m256i swapped =
+          _mm256_shuffle_epi32(input, _MM_SHUFFLE(1, 0, 3, 2));
+      acc[reg] = _mm256_add_epi64(acc[reg],
+                                  _mm256_add_epi64(swapped, product));
+    }
+    data += WIDE_STRIPE_SIZE;
+
+    if (0 == (stripe % WIDE_STRIPES_PER_SCRAMBLE)) {
+      for (size_t reg = 0; reg < AVX2_REGISTERS_COUNT; ++reg) {
+        __m256i value = _mm256_xor_si256(
+            acc[reg], _mm256_srli_epi64(acc[reg], WIDE_SCRAMBLE_SHIFT));
+        value = _mm256_xor_si256(value, key[reg]);
+        // 64x32 bit multiplication out of two 32x32 bit ones
+        const __m256i low = _mm256_mul_epu32(value, prime);
+        const __m256i high =
+            _mm256_mul_epu32(_mm256_srli_epi64(value, 32), prime);
+        acc[reg] = _mm256_add_epi64(low, _mm256_slli_epi64(high, 32));
+      }
+    }
+  }
+
+  for (size_t reg = 0; reg < AVX2_REGISTERS_COUNT; ++reg) {
+    _mm256_storeu_si256(reinterpret_cast<__m256i*>(
+        lanes.data() + (reg * AVX2_LANES_COUNT)), acc[reg]);
+  }
+}
+#endif
+}
+
+uint64_t HashUtils::hashResourcePath(const std::string& path) {
+  uint64_t hashValue = FNV_OFFSET_BASIS;
+  for (const char letter : path) {
+    const char normalized = ('\\' == letter) ? '/' : letter;
+    hashValue ^= static_cast<unsigned char>(normalized);
+    hashValue *= FNV_PRIME;
+  }
+
+  return hashValue;
+}
+
+uint64_t HashUtils::hashData(const uint8_t* data, size_t size,
+                             uint64_t seed) {
+  const uint8_t* const end = data + size;
+  uint64_t hashValue = 0;
+
+  if (XXH_STRIPE_SIZE <= size) {
+    uint64_t lanes[4] = { seed + XXH_PRIME64_1 + XXH_PRIME64_2,
+                          seed + XXH_PRIME64_2, seed, seed - XXH_PRIME64_1 };
+    const uint8_t* const lastStripe = end - XXH_STRIPE_SIZE;
+    do {
+      for (uint64_t& lane : lanes) {
+        lane = xxhRound(lane, ByteReader::readLittleEndian64(
+                                  { data, end }));
+        data += sizeof(uint64_t);
+      }
+    } while (data <= lastStripe);
+
+    hashValue = rotateLeft(lanes[0], 1) + rotateLeft(lanes[1], 7) +
+                rotateLeft(lanes[2], 12) + rotateLeft(lanes[3], 18);
+    for (const uint64_t lane : lanes) {
+      hashValue = xxhMergeRound(hashValue, lane);
+    }
+  } else {
+    hashValue = seed + XXH_PRIME64_5;
+  }
+
+  hashValue += static_cast<uint64_t>(size);
+
+  for (; (data + sizeof(uint64_t)) <= end; data += sizeof(uint64_t)) {
+    hashValue ^= xxhRound(0, ByteReader::readLittleEndian64({ data, end }));
+    hashValue = (rotateLeft(hashValue, 27) * XXH_PRIME64_1) + XXH_PRIME64_4;
+  }
+
+  if ((data + sizeof(uint32_t)) <= end) {
+    hashValue ^= static_cast<uint64_t>(
+        ByteReader::readLittleEndian32({ data, end })) * XXH_PRIME64_1;
+    hashValue = (rotateLeft(hashValue, 23) * XXH_PRIME64_2) + XXH_PRIME64_3;
+    data += sizeof(uint32_t);
+  }
+
+  for (; data < end; ++data) {
+    hashValue ^= (*data) * XXH_PRIME64_5;
+    hashValue = rotateLeft(hashValue, 11) * XXH_PRIME64_1;
+  }
+
+  return xxhAvalanche(hashValue);
+}
+
+uint64_t HashUtils::hashDataWide(const uint8_t* data, size_t size,
+                                 uint64_t seed) {
+  WideLanes lanes = WIDE_INITIAL_LANES;
+  WideLanes keys = WIDE_KEYS;
+  for (uint64_t& key : keys) {
+    key += seed;
+  }
+
+  auto accumulate = &hashStripes;
+#ifdef HASH_AVX2_SUPPORTED
+  if (hasAvx2()) {
+    accumulate = &hashStripesAvx2;
+  }
+#endif
+
+  const size_t stripesCount = size / WIDE_STRIPE_SIZE;
+  accumulate(lanes, keys, data, stripesCount);
+
+  // the last partial stripe is zero padded - the size is mixed in below
+  const size_t tailSize = size % WIDE_STRIPE_SIZE;
+  if (0 != tailSize) {
+    uint8_t lastStripe[WIDE_STRIPE_SIZE] = {0};
+    memcpy(lastStripe, data + (stripesCount * WIDE_STRIPE_SIZE), tailSize);
+    accumulate(lanes, keys, lastStripe, 1);
+  }
+
+  uint64_t hashValue = seed + (static_cast<uint64_t>(size) * XXH_PRIME64_1);
+  for (const uint64_t lane : lanes) {
+    hashValue = xxhMergeRound(hashValue, lane);
+  }
+
+  return xxhAvalanche(hashValue);
+}
+
+uint64_t HashUtils::hashDigest(uint64_t digest, uint64_t seed) {
+  uint8_t bytes[sizeof(uint64_t)] = {0};
+  for (size_t i = 0; i < sizeof(bytes); ++i) {
+    bytes[i] = static_cast<uint8_t>(digest >> (8 * i));
+  }
+
+  return hashData(bytes, sizeof(bytes), seed);
+}
+
+uint32_t HashUtils::crc32(const uint8_t* data, size_t size, uint32_t crc) {
+  crc = ~crc;
+
+#ifdef CRC32_PCLMUL_SUPPORTED
+  if ((PCLMUL_FOLD_SIZE <= size) && hasPclmul()) {
+    // the tail, shorter than a block, is processed with the table
+    const size_t foldedSize = size & ~(PCLMUL_BLOCK_SIZE - 1);
+    crc = crc32Pclmul(data, foldedSize, crc);
+    data += foldedSize;
+    size -= foldedSize;
+  }
+#endif
+
+  return ~crc32Table(data, size, crc);
+}
+
+uint32_t HashUtils::crc32Ogg(const uint8_t* data, size_t size,
+                             uint32_t crc) {
+  for (size_t i = 0; i < size; ++i) {
+    crc = CRC32_OGG_TABLE[((crc >> 24) ^ data[i]) & 0xFFU] ^ (crc << 8);
+  }
+
+  return crc;
+}
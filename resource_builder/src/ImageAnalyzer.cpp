@@ -0,0 +1,329 @@
+// Corresponding header
+#include "resource_builder/ImageAnalyzer.h"
+
+// System headers
+#include <algorithm>
+#include <cinttypes>
+#include <cstring>
+#include <fstream>
+#include <iterator>
+#include <unordered_map>
+
+// Other libraries headers
+#include "utils/debug/StrError.h"
+#include "utils/log/Log.h"
+
+// Own components headers
+#include "resource_builder/BuilderStructs.h"
+#include "resource_builder/HashUtils.h"
+#include "resource_builder/PngCodec.h"
+#include "resource_builder/ResourceBuilderConfig.h"
+
+namespace {
+constexpr auto PERCENT_MULTIPLIER = 100.0;
+
+bool isTransparent(const RgbaImage& image, const int32_t x, const int32_t y) {
+  const size_t pixel = (static_cast<size_t>(y) * image.width) +
+                       static_cast<size_t>(x);
+  return 0 == image.pixels[(pixel * RgbaImage::CHANNELS) + 3];
+}
+
+/** @brief used to compute the tight bounds of the non fully transparent
+ *         pixels inside a frame (already clamped to the image).
+ * */
+FrameTrim trimFrame(const RgbaImage& image, const Rectangle& frame) {
+  FrameTrim trim;
+  trim.rect = Rectangle(frame.x, frame.y, 0, 0);
+
+  const int32_t left = std::max(frame.x, 0);
+  const int32_t top = std::max(frame.y, 0);
+  const int32_t right =
+      std::min(frame.x + frame.w, static_cast<int32_t>(image.width));
+  const int32_t bottom =
+      std::min(frame.y + frame.h, static_cast<int32_t>(image.height));
+  if ((left >= right) || (top >= bottom)) {
+    return trim;
+  }
+
+  auto isRowTransparent = [&](const int32_t y) {
+    for (int32_t x = left; x < right; ++x) {
+      if (!isTransparent(image, x, y)) {
+        return false;
+      }
+    }
+    return true;
+  };
+
+  int32_t minY = top;
+  while ((minY < bottom) && isRowTransparent(minY)) {
+    ++minY;
+  }
+
+  // fully transparent frame
+  if (minY == bottom) {
+    return trim;
+  }
+
+  int32_t maxY = bottom - 1;
+  while (isRowTransparent(maxY)) {
+    --maxY;
+  }
+
+  auto isColumnTransparent = [&](const int32_t x) {
+    for (int32_t y = minY; y <= maxY; ++y) {
+      if (!isTransparent(image, x, y)) {
+        return false;
+      }
+    }
+    return true;
+  };
+
+  int32_t minX = left;
+  while (isColumnTransparent(minX)) {
+    ++minX;
+  }
+
+  int32_t maxX = right - 1;
+  while (isColumnTransparent(maxX)) {
+    --maxX;
+  }
+
+  trim.rect = Rectangle(minX, minY, (maxX - minX) + 1, (maxY - minY) + 1);
+  trim.offsetX = minX - frame.x;
+  trim.offsetY = minY - frame.y;
+  return trim;
+}
+
+bool isInsideImage(const RgbaImage& image, const Rectangle& frame) {
+  return (0 <= frame.x) && (0 <= frame.y) && (0 < frame.w) && (0 < frame.h) &&
+         (static_cast<int64_t>(frame.x) + frame.w <= image.width) &&
+         (static_cast<int64_t>(frame.y) + frame.h <= image.height);
+}
+
+const uint8_t* getRow(const RgbaImage& image, const Rectangle& frame,
+                      const int32_t row) {
+  const size_t pixel =
+      (static_cast<size_t>(frame.y + row) * image.width) +
+      static_cast<size_t>(frame.x);
+  return &image.pixels[pixel * RgbaImage::CHANNELS];
+}
+
+/** @brief used to hash the pixels of a frame with the SIMD accelerated
+ *         HashUtils::hashDataWide().
+ *         Frames, which span whole image rows are contiguous in memory
+ *         and are hashed with a single call. Otherwise every row hash
+ *         seeds the next one, so the frame pixels do not need to be
+ *         copied. Equal frames have equal widths, so they always take
+ *         the same path and end up with the same hash.
+ * */
+uint64_t hashFrame(const RgbaImage& image, const Rectangle& frame) {
+  const size_t rowSize = static_cast<size_t>(frame.w) * RgbaImage::CHANNELS;
+  if (static_cast<uint32_t>(frame.w) == image.width) {
+    return HashUtils::hashDataWide(getRow(image, frame, 0),
+                                   rowSize * static_cast<size_t>(frame.h));
+  }
+
+  uint64_t hashValue = 0;
+  for (int32_t row = 0; row < frame.h; ++row) {
+    hashValue = HashUtils::hashDataWide(getRow(image, frame, row), rowSize,
+                                        hashValue);
+  }
+  return hashValue;
+}
+
+bool areFramesEqual(const RgbaImage& image, const Rectangle& lhs,
+                    const Rectangle& rhs) {
+  if ((lhs.w != rhs.w) || (lhs.h != rhs.h)) {
+    return false;
+  }
+
+  const size_t rowSize = static_cast<size_t>(lhs.w) * RgbaImage::CHANNELS;
+  for (int32_t row = 0; row < lhs.h; ++row) {
+    if (0 != memcmp(getRow(image, lhs, row), getRow(image, rhs, row),
+                    rowSize)) {
+      return false;
+    }
+  }
+  return true;
+}
+}
+
+ImageAnalyzer::ImageAnalyzer() : _trimFrames(false), _dedupeFrames(false) {}
+
+void ImageAnalyzer::init(const ResourceBuilderConfig& config) {
+  _trimFrames = config.trimFrames;
+  _dedupeFrames = config.dedupeFrames;
+}
+
+ErrorCode ImageAnalyzer::analyze(
+    std::vector<BuilderCombinedData>& data) const {
+  uint64_t framesArea = 0;
+  uint64_t trimmedArea = 0;
+  uint64_t framesCount = 0;
+  uint64_t duplicateFramesCount = 0;
+  uint64_t duplicateFramesArea = 0;
+
+  RgbaImage image;
+  std::string decodedFilePath;
+  for (auto& entry : data) {
+    if (("font" == entry.type) || ("sound" == entry.type)) {
+      continue;
+    }
+
+    // consecutive entries commonly share the same image
+    if (decodedFilePath != entry.absoluteFilePath) {
+      decodedFilePath.clear();
+
+      bool isSupported = false;
+      if (ErrorCode::SUCCESS != decodeImage(entry, image, isSupported)) {
+        LOGERR("Error, decodeImage() failed for: %s",
+               entry.header.path.c_str());
+        return ErrorCode::FAILURE;
+      }
+
+      if (!isSupported) {
+        LOGR("Warning, image: %s is not a PNG. It will not be analyzed",
+             entry.header.path.c_str());
+        continue;
+      }
+      decodedFilePath = entry.absoluteFilePath;
+    }
+
+    if (_trimFrames) {
+      trimFrames(image, entry);
+
+      for (size_t i = 0; i < entry.frameTrims.size(); ++i) {
+        const Rectangle& frame = entry.spriteData[i];
+        const Rectangle& trimmed = entry.frameTrims[i].rect;
+        framesArea += static_cast<uint64_t>(frame.w) *
+                      static_cast<uint64_t>(frame.h);
+        trimmedArea += static_cast<uint64_t>(trimmed.w) *
+                       static_cast<uint64_t>(trimmed.h);
+      }
+    }
+
+    if (_dedupeFrames) {
+      framesCount += entry.spriteData.size();
+      const uint64_t duplicatesArea = dedupeFrames(image, entry);
+      if (!entry.frameRemap.empty()) {
+        uint64_t duplicatesCount = 0;
+        for (size_t i = 0; i < entry.frameRemap.size(); ++i) {
+          duplicatesCount += (i != entry.frameRemap[i]) ? 1 : 0;
+        }
+        duplicateFramesCount += duplicatesCount;
+        duplicateFramesArea += duplicatesArea;
+
+        const uint64_t imageArea =
+            static_cast<uint64_t>(image.width) * image.height;
+        LOG("%s: %" PRIu64 " of %zu frames are duplicates. Repacking would "
+            "shrink the sheet by %" PRIu64 " pixels (%.1f%%)",
+            entry.header.path.c_str(), duplicatesCount,
+            entry.spriteData.size(), duplicatesArea, PERCENT_MULTIPLIER *
+            static_cast<double>(duplicatesArea) /
+            static_cast<double>(imageArea));
+      }
+    }
+  }
+
+  if (_trimFrames) {
+    const double savedPercent = (0 == framesArea) ? 0.0 :
+        PERCENT_MULTIPLIER * static_cast<double>(framesArea - trimmedArea) /
+        static_cast<double>(framesArea);
+    LOG_ON_SAME_LINE("Frames trimming ... (%" PRIu64 " of %" PRIu64
+                     " pixels kept, %.1f%% saved) ", trimmedArea, framesArea,
+                     savedPercent);
+    LOGG("[Done]");
+  }
+
+  if (_dedupeFrames) {
+    LOG_ON_SAME_LINE("Duplicate frames detection ... (%" PRIu64 " of %"
+                     PRIu64 " frames with %" PRIu64 " pixels collapsed) ",
+                     duplicateFramesCount, framesCount, duplicateFramesArea);
+    LOGG("[Done]");
+  }
+
+  return ErrorCode::SUCCESS;
+}
+
+ErrorCode ImageAnalyzer::decodeImage(const BuilderCombinedData& entry,
+                                     RgbaImage& outImage,
+                                     bool& outIsSupported) {
+  outIsSupported = false;
+
+  std::ifstream imageStream(entry.absoluteFilePath.c_str(),
+                            std::ifstream::in | std::ifstream::binary);
+  if (!imageStream) {
+    LOGERR("Error, could not open ifstream for fileName: %s, reason: %s",
+           entry.absoluteFilePath.c_str(), strError().c_str());
+    return ErrorCode::FAILURE;
+  }
+
+  const std::vector<uint8_t> fileData(
+      (std::istreambuf_iterator<char>(imageStream)),
+      std::istreambuf_iterator<char>());
+  if (!PngCodec::hasSignature(fileData)) {
+    return ErrorCode::SUCCESS;
+  }
+
+  if (ErrorCode::SUCCESS != PngCodec::decode(fileData, outImage)) {
+    LOGERR("Error, could not decode image: %s",
+           entry.absoluteFilePath.c_str());
+    return ErrorCode::FAILURE;
+  }
+
+  outIsSupported = true;
+  return ErrorCode::SUCCESS;
+}
+
+void ImageAnalyzer::trimFrames(const RgbaImage& image,
+                               BuilderCombinedData& entry) {
+  entry.frameTrims.clear();
+  entry.frameTrims.reserve(entry.spriteData.size());
+  for (const Rectangle& frame : entry.spriteData) {
+    entry.frameTrims.push_back(trimFrame(image, frame));
+  }
+}
+
+uint64_t ImageAnalyzer::dedupeFrames(const RgbaImage& image,
+                                     BuilderCombinedData& entry) {
+  entry.frameRemap.clear();
+
+  const size_t framesCount = entry.spriteData.size();
+  std::vector<uint32_t> remap(framesCount);
+
+  // frame hash -> indices of the unique frames with that hash
+  std::unordered_map<uint64_t, std::vector<uint32_t>> uniqueFrames;
+  uint64_t duplicatesArea = 0;
+  bool hasDuplicates = false;
+
+  for (uint32_t i = 0; i < framesCount; ++i) {
+    remap[i] = i;
+    const Rectangle& frame = entry.spriteData[i];
+    if (!isInsideImage(image, frame)) {
+      continue;
+    }
+
+    // equal hash values are confirmed pixel by pixel
+    auto& candidates = uniqueFrames[hashFrame(image, frame)];
+    const auto it = std::find_if(candidates.begin(), candidates.end(),
+        [&](const uint32_t candidate) {
+          return areFramesEqual(image, entry.spriteData[candidate], frame);
+        });
+
+    if (candidates.end() == it) {
+      candidates.push_back(i);
+      continue;
+    }
+
+    remap[i] = *it;
+    duplicatesArea += static_cast<uint64_t>(frame.w) *
+                      static_cast<uint64_t>(frame.h);
+    hasDuplicates = true;
+  }
+
+  if (hasDuplicates) {
+    entry.frameRemap = std::move(remap);
+  }
+
+  return duplicatesArea;
+}
@@ -0,0 +1,212 @@
+// Corresponding header
+#include "resource_builder/IntegrityVerifier.h"
+
+// System headers
+#include <algorithm>
+#include <atomic>
+#include <cinttypes>
+#include <cstring>
+#include <fstream>
+#include <iomanip>
+#include <iterator>
+#include <span>
+#include <sstream>
+#include <thread>
+
+// Other libraries headers
+#include "utils/log/Log.h"
+
+// Own components headers
+#include "resource_builder/BuilderStructs.h"
+#include "resource_builder/ByteReader.h"
+#include "resource_builder/HashUtils.h"
+#include "resource_builder/OggPage.h"
+#include "resource_builder/PngCodec.h"
+
+namespace {
+constexpr double BYTES_PER_MB = 1024.0 * 1024.0;
+
+constexpr size_t PNG_SIGNATURE_SIZE = 8;
+constexpr size_t PNG_CHUNK_HEADER_SIZE = 8;
+constexpr size_t PNG_CHUNK_CRC_SIZE = 4;
+constexpr uint32_t PNG_MAX_CHUNK_LENGTH = 0x7FFFFFFFU;
+
+constexpr uint8_t JPG_MARKER = 0xFF;
+constexpr uint8_t JPG_SOI = 0xD8;
+constexpr uint8_t JPG_EOI = 0xD9;
+
+std::string toHex(const uint32_t value) {
+  std::ostringstream stream;
+  stream << "0x" << std::hex << std::uppercase << std::setw(8)
+         << std::setfill('0') << value;
+  return stream.str();
+}
+}
+
+ErrorCode IntegrityVerifier::verify(
+    const std::vector<BuilderCombinedData>& data) const {
+  std::vector<AssetResult> results(data.size());
+  std::atomic<size_t> nextIdx(0);
+
+  // every worker takes the next unverified asset, so a few huge assets
+  // do not leave the other workers idle
+  const auto worker = [&data, &results, &nextIdx]() {
+    for (size_t idx = nextIdx++; idx < data.size(); idx = nextIdx++) {
+      verifyAsset(data[idx].absoluteFilePath, results[idx]);
+    }
+  };
+
+  const size_t threadsCount = std::max<size_t>(
+      1, std::min<size_t>(std::thread::hardware_concurrency(), data.size()));
+  std::vector<std::thread> threads;
+  threads.reserve(threadsCount - 1);
+  for (size_t i = 1; i < threadsCount; ++i) {
+    threads.emplace_back(worker);
+  }
+  worker();
+  for (auto& thread : threads) {
+    thread.join();
+  }
+
+  auto err = ErrorCode::SUCCESS;
+  uint64_t checkedCount = 0;
+  uint64_t totalSize = 0;
+  for (size_t i = 0; i < data.size(); ++i) {
+    if (!results[i].error.empty()) {
+      LOGERR("Error, corrupted asset: %s - %s",
+             data[i].header.path.c_str(), results[i].error.c_str());
+      err = ErrorCode::FAILURE;
+    }
+
+    checkedCount += results[i].isChecked ? 1 : 0;
+    totalSize += results[i].fileSize;
+  }
+
+  if (ErrorCode::SUCCESS != err) {
+    return err;
+  }
+
+  LOG_ON_SAME_LINE("Integrity verification ... (%" PRIu64 " of %zu files "
+                   "checked, %.3f MB read by %zu threads) ", checkedCount,
+                   data.size(), static_cast<double>(totalSize) / BYTES_PER_MB,
+                   threadsCount);
+  LOGG("[Done]");
+
+  return ErrorCode::SUCCESS;
+}
+
+void IntegrityVerifier::verifyAsset(const std::string& filePath,
+                                    AssetResult& outResult) {
+  std::ifstream stream(filePath.c_str(),
+                       std::ifstream::in | std::ifstream::binary);
+  if (!stream) {
+    outResult.error = "file could not be opened";
+    return;
+  }
+
+  const std::vector<uint8_t> fileData(
+      (std::istreambuf_iterator<char>(stream)),
+      std::istreambuf_iterator<char>());
+  if (stream.bad()) {
+    outResult.error = "file could not be read";
+    return;
+  }
+  outResult.fileSize = fileData.size();
+
+  // the format is detected by the magic bytes, not by the extension
+  if (PngCodec::hasSignature(fileData)) {
+    outResult.error = verifyPng(fileData);
+    outResult.isChecked = true;
+  } else if ((2 <= fileData.size()) && (JPG_MARKER == fileData[0]) &&
+             (JPG_SOI == fileData[1])) {
+    outResult.error = verifyJpg(fileData);
+    outResult.isChecked = true;
+  } else if ((4 <= fileData.size()) &&
+             (0 == memcmp(fileData.data(), "OggS", 4))) {
+    outResult.error = verifyOgg(fileData);
+    outResult.isChecked = true;
+  }
+}
+
+std::string IntegrityVerifier::verifyPng(
+    const std::vector<uint8_t>& fileData) {
+  const size_t size = fileData.size();
+  size_t pos = PNG_SIGNATURE_SIZE;
+
+  while (true) {
+    if (pos + PNG_CHUNK_HEADER_SIZE + PNG_CHUNK_CRC_SIZE > size) {
+      return "truncated before the 'IEND' chunk at offset " +
+             std::to_string(pos);
+    }
+
+    const uint8_t* chunk = fileData.data() + pos;
+    const uint32_t length = ByteReader::readBigEndian32(fileData, pos);
+    const std::string type(reinterpret_cast<const char*>(chunk + 4), 4);
+    if ((PNG_MAX_CHUNK_LENGTH < length) ||
+        (length > size - pos - PNG_CHUNK_HEADER_SIZE - PNG_CHUNK_CRC_SIZE)) {
+      return "chunk '" + type + "' at offset " + std::to_string(pos) +
+             " has out of bound length: " + std::to_string(length);
+    }
+
+    // the CRC covers the chunk type and data, but not the length
+    const uint32_t crc = HashUtils::crc32(chunk + 4, length + 4);
+    const uint32_t storedCrc = ByteReader::readBigEndian32(
+        fileData, pos + PNG_CHUNK_HEADER_SIZE + length);
+    if (crc != storedCrc) {
+      return "chunk '" + type + "' at offset " + std::to_string(pos) +
+             " has stored CRC " + toHex(storedCrc) + ", computed CRC " +
+             toHex(crc);
+    }
+
+    if ("IEND" == type) {
+      return std::string();
+    }
+
+    pos += PNG_CHUNK_HEADER_SIZE + length + PNG_CHUNK_CRC_SIZE;
+  }
+}
+
+std::string IntegrityVerifier::verifyJpg(
+    const std::vector<uint8_t>& fileData) {
+  // some encoders pad the file with zero bytes after the EOI marker
+  size_t end = fileData.size();
+  while ((0 < end) && (0 == fileData[end - 1])) {
+    --end;
+  }
+
+  if ((4 > end) || (JPG_MARKER != fileData[end - 2]) ||
+      (JPG_EOI != fileData[end - 1])) {
+    return "missing end of image (EOI) marker, the file is truncated";
+  }
+
+  return std::string();
+}
+
+std::string IntegrityVerifier::verifyOgg(
+    const std::vector<uint8_t>& fileData) {
+  OggPageInfo page;
+  size_t pos = 0;
+
+  while (pos < fileData.size()) {
+    const auto pageData = std::span<const uint8_t>(fileData).subspan(pos);
+    switch (OggPage::read(pageData, page)) {
+      case OggPageStatus::VALID:
+        break;
+      case OggPageStatus::INVALID_HEADER:
+        return "invalid or truncated page header at offset " +
+               std::to_string(pos);
+      case OggPageStatus::TRUNCATED_SEGMENT_TABLE:
+        return "truncated segment table at offset " + std::to_string(pos);
+      case OggPageStatus::TRUNCATED_PAGE:
+        return "truncated page at offset " + std::to_string(pos);
+      case OggPageStatus::CRC_MISMATCH:
+        return "page at offset " + std::to_string(pos) +
+               " has stored CRC " + toHex(page.storedCrc) +
+               ", computed CRC " + toHex(page.computedCrc);
+    }
+
+    pos += page.size;
+  }
+
+  return std::string();
+}
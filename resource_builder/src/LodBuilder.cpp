@@ -0,0 +1,404 @@
+// Corresponding header
+#include "resource_builder/LodBuilder.h"
+
+// System headers
+#include <algorithm>
+#include <bit>
+#include <cctype>
+#include <cinttypes>
+#include <cmath>
+#include <cstdlib>
+#include <filesystem>
+#include <fstream>
+#include <functional>
+#include <iomanip>
+#include <iterator>
+#include <sstream>
+#include <system_error>
+
+// Other libraries headers
+#include "utils/debug/StrError.h"
+#include "utils/log/Log.h"
+
+// Own components headers
+#include "resource_builder/AtomicFileStream.h"
+#include "resource_builder/BuilderStructs.h"
+#include "resource_builder/HashUtils.h"
+#include "resource_builder/PngCodec.h"
+
+namespace {
+constexpr auto MAX_UINT64_T_HEX_LENGTH = 16;
+constexpr auto LODS_FOLDER_NAME = "lods";
+constexpr auto LOD_FILE_EXTENSION = ".png";
+constexpr uint64_t LOD_VERSION = 1;
+constexpr auto LOD_VERSION_SHIFT = 56;
+constexpr auto COLOR_CHANNELS = 3;
+constexpr auto ALPHA_CHANNEL = 3;
+constexpr float MAX_CHANNEL_VALUE = 255.0f;
+
+/* Contribution of a single source pixel to a destination pixel */
+struct FilterTap {
+  int32_t srcIdx = 0;
+  float weight = 0.0f;
+};
+
+/** @brief used to compute the area filter taps of every destination pixel
+ *         along a single axis. The footprint of a destination pixel
+ *         covers 'srcSize / dstSize' source pixels.
+ * */
+std::vector<std::vector<FilterTap>> computeTaps(const int32_t srcSize,
+                                                const int32_t dstSize) {
+  std::vector<std::vector<FilterTap>> taps(dstSize);
+  const double ratio =
+      static_cast<double>(srcSize) / static_cast<double>(dstSize);
+
+  for (int32_t dst = 0; dst < dstSize; ++dst) {
+    const double start = dst * ratio;
+    const double end = std::min((dst + 1) * ratio,
+                                static_cast<double>(srcSize));
+    const int32_t first = static_cast<int32_t>(std::floor(start));
+    const int32_t last = std::min(static_cast<int32_t>(std::ceil(end)),
+                                  srcSize);
+
+    for (int32_t src = first; src < last; ++src) {
+      const double overlap =
+          std::min(end, src + 1.0) - std::max(start, static_cast<double>(src));
+      if (0.0 < overlap) {
+        taps[dst].push_back(
+            { src, static_cast<float>(overlap / (end - start)) });
+      }
+    }
+  }
+
+  return taps;
+}
+
+int32_t scaleCoordinate(const int32_t value, const double scale) {
+  return static_cast<int32_t>(std::lround(value * scale));
+}
+
+/** @brief used to scale a rectangle, keeping adjacent rectangles adjacent
+ * */
+Rectangle scaleRectangle(const Rectangle& rect, const double scaleX,
+                         const double scaleY) {
+  Rectangle scaled;
+  scaled.x = scaleCoordinate(rect.x, scaleX);
+  scaled.y = scaleCoordinate(rect.y, scaleY);
+  scaled.w = scaleCoordinate(rect.x + rect.w, scaleX) - scaled.x;
+  scaled.h = scaleCoordinate(rect.y + rect.h, scaleY) - scaled.y;
+  return scaled;
+}
+
+bool isImageEntry(const BuilderCombinedData& entry) {
+  return ("font" != entry.type) && ("sound" != entry.type);
+}
+}
+
+void LodBuilder::init(const std::vector<double>& defaultScales) {
+  _defaultScales = defaultScales;
+}
+
+ErrorCode LodBuilder::writeData(const std::string& destDir,
+                                const std::vector<BuilderCombinedData>& data,
+                                const bool syncToDisk) {
+  reset();
+
+  const std::filesystem::path lodsDir =
+      std::filesystem::path(destDir) / LODS_FOLDER_NAME;
+  std::error_code errorCode;
+  std::ostringstream nameStream;
+  uint64_t resampledCount = 0;
+  uint64_t reusedCount = 0;
+  uint64_t sourceBytes = 0;
+  uint64_t lodBytes = 0;
+  bool hasScales = false;
+
+  for (const auto& entry : data) {
+    const std::vector<double>& scales =
+        entry.lodScales.empty() ? _defaultScales : entry.lodScales;
+    if (!isImageEntry(entry) || scales.empty() ||
+        (_lods.end() != _lods.find(entry.header.hashValue))) {
+      continue;
+    }
+    hasScales = true;
+
+    if (TextureContainer::NONE != entry.imageInfo.container) {
+      LOGR("Warning, image: %s is a GPU compressed texture. It's own mip "
+           "levels are used instead of LODs", entry.header.path.c_str());
+      continue;
+    }
+
+    if (!entry.imageInfo.isPng) {
+      LOGR("Warning, image: %s is not a PNG. No LODs will be generated",
+           entry.header.path.c_str());
+      continue;
+    }
+
+    if ((0 >= entry.imageRect.w) || (0 >= entry.imageRect.h)) {
+      LOGR("Warning, image: %s has unknown dimensions. No LODs will be "
+           "generated", entry.header.path.c_str());
+      continue;
+    }
+
+    auto& lods = _lods[entry.header.hashValue];
+    const uint64_t lodFilesCount = resampledCount + reusedCount;
+    RgbaImage image;
+    for (const double scale : scales) {
+      // the source image itself
+      if (1.0 == scale) {
+        continue;
+      }
+
+      TextureLod lod;
+      lod.scale = scale;
+      const int32_t width =
+          std::max(scaleCoordinate(entry.imageRect.w, scale), 1);
+      const int32_t height =
+          std::max(scaleCoordinate(entry.imageRect.h, scale), 1);
+
+      // the frames are scaled with the exact (rounded) image ratio,
+      // so they stay aligned to the resampled pixels
+      const double scaleX = static_cast<double>(width) / entry.imageRect.w;
+      const double scaleY = static_cast<double>(height) / entry.imageRect.h;
+      lod.imageRect.x = scaleCoordinate(entry.imageRect.x, scale);
+      lod.imageRect.y = scaleCoordinate(entry.imageRect.y, scale);
+      lod.imageRect.w = width;
+      lod.imageRect.h = height;
+      lod.spriteData.reserve(entry.spriteData.size());
+      for (const auto& sprite : entry.spriteData) {
+        lod.spriteData.push_back(scaleRectangle(sprite, scaleX, scaleY));
+      }
+
+      // the LOD version and the scale are part of the key,
+      // since they change the LOD content
+      const uint64_t keySeed = std::bit_cast<uint64_t>(scale) ^
+                               (LOD_VERSION << LOD_VERSION_SHIFT);
+      const uint64_t contentHash =
+          HashUtils::hashDigest(entry.contentDigest, keySeed);
+      nameStream.str("");
+      nameStream << "0x" << std::hex << std::uppercase
+                 << std::setw(MAX_UINT64_T_HEX_LENGTH) << std::setfill('0')
+                 << contentHash << LOD_FILE_EXTENSION;
+      lod.fileName =
+          (std::filesystem::path(LODS_FOLDER_NAME) / nameStream.str())
+              .generic_string();
+      const std::filesystem::path lodPath = lodsDir / nameStream.str();
+
+      const bool isNewFile = _usedFileNames.insert(lod.fileName).second;
+      lods.push_back(std::move(lod));
+      if (!isNewFile) {
+        continue;
+      }
+
+      // LODs are content addressed - an existing LOD is always up to date
+      if (std::filesystem::is_regular_file(lodPath, errorCode)) {
+        lodBytes += std::filesystem::file_size(lodPath, errorCode);
+        ++reusedCount;
+        continue;
+      }
+
+      // the image is read and decoded only once a LOD has to be produced
+      if (image.pixels.empty()) {
+        std::ifstream imageStream(entry.absoluteFilePath.c_str(),
+                                  std::ifstream::in | std::ifstream::binary);
+        if (!imageStream) {
+          LOGERR("Error, could not open ifstream for fileName: %s, reason: "
+                 "%s", entry.absoluteFilePath.c_str(), strError().c_str());
+          return ErrorCode::FAILURE;
+        }
+        const std::vector<uint8_t> fileData(
+            (std::istreambuf_iterator<char>(imageStream)),
+            std::istreambuf_iterator<char>());
+
+        if (ErrorCode::SUCCESS != PngCodec::decode(fileData, image)) {
+          LOGERR("Error, could not decode image: %s",
+                 entry.absoluteFilePath.c_str());
+          return ErrorCode::FAILURE;
+        }
+
+        if ((image.width != static_cast<uint32_t>(entry.imageRect.w)) ||
+            (image.height != static_cast<uint32_t>(entry.imageRect.h))) {
+          LOGERR("Error, decoded dimensions: %ux%u of image: %s do not "
+                 "match the parsed dimensions: %dx%d", image.width,
+                 image.height, entry.header.path.c_str(), entry.imageRect.w,
+                 entry.imageRect.h);
+          return ErrorCode::FAILURE;
+        }
+      }
+
+      RgbaImage lodImage;
+      downscale(image, width, height, lodImage);
+
+      std::vector<uint8_t> pngData;
+      if (ErrorCode::SUCCESS != PngCodec::encode(lodImage, pngData)) {
+        LOGERR("Error, could not encode LOD: %s of image: %s",
+               lodPath.string().c_str(), entry.header.path.c_str());
+        return ErrorCode::FAILURE;
+      }
+
+      std::filesystem::create_directories(lodsDir, errorCode);
+      if (errorCode) {
+        LOGERR("Error, could not create directory: %s, reason: %s",
+               lodsDir.string().c_str(), errorCode.message().c_str());
+        return ErrorCode::FAILURE;
+      }
+
+      AtomicFileStream lodStream;
+      if (ErrorCode::SUCCESS != lodStream.begin(lodPath.string())) {
+        LOGERR("Error in lodStream.begin()");
+        return ErrorCode::FAILURE;
+      }
+      lodStream.write(reinterpret_cast<const char*>(pngData.data()),
+                      static_cast<std::streamsize>(pngData.size()));
+      if (ErrorCode::SUCCESS != lodStream.publish(syncToDisk)) {
+        LOGERR("Error, could not publish: %s", lodPath.string().c_str());
+        return ErrorCode::FAILURE;
+      }
+
+      lodBytes += pngData.size();
+      ++resampledCount;
+    }
+
+    // the source is accounted once, no matter how many LODs it has
+    if (resampledCount + reusedCount != lodFilesCount) {
+      sourceBytes += entry.fileSize;
+    }
+  }
+
+  if (hasScales) {
+    LOG_ON_SAME_LINE("LODs generation ... (%" PRIu64 " resampled, %" PRIu64
+                     " reused, %" PRIu64 " bytes for %" PRIu64
+                     " source bytes) ", resampledCount, reusedCount,
+                     lodBytes, sourceBytes);
+    LOGG("[Done]");
+  }
+
+  return ErrorCode::SUCCESS;
+}
+
+const std::vector<TextureLod>* LodBuilder::getLods(
+    const uint64_t hashValue) const {
+  const auto it = _lods.find(hashValue);
+  if ((_lods.end() == it) || it->second.empty()) {
+    return nullptr;
+  }
+
+  return &it->second;
+}
+
+void LodBuilder::removeStaleLods(const std::string& destDir) const {
+  const std::filesystem::path lodsDir =
+      std::filesystem::path(destDir) / LODS_FOLDER_NAME;
+
+  std::error_code errorCode;
+  if (!std::filesystem::is_directory(lodsDir, errorCode)) {
+    return;
+  }
+
+  for (const auto& dirEntry :
+       std::filesystem::directory_iterator(lodsDir, errorCode)) {
+    const std::filesystem::path& path = dirEntry.path();
+    const std::string name =
+        (std::filesystem::path(LODS_FOLDER_NAME) / path.filename())
+            .generic_string();
+    if ((LOD_FILE_EXTENSION == path.extension().string()) &&
+        (_usedFileNames.end() == _usedFileNames.find(name))) {
+      std::filesystem::remove(path, errorCode);
+    }
+  }
+}
+
+void LodBuilder::reset() {
+  _lods.clear();
+  _usedFileNames.clear();
+}
+
+bool LodBuilder::parseScales(const std::string& text,
+                             std::vector<double>& outScales) {
+  outScales.clear();
+
+  std::istringstream scalesStream(text);
+  std::string scaleStr;
+  while (std::getline(scalesStream, scaleStr, ',')) {
+    if (scaleStr.empty() ||
+        !isdigit(static_cast<unsigned char>(scaleStr.front()))) {
+      return false;
+    }
+
+    char* end = nullptr;
+    const double scale = strtod(scaleStr.c_str(), &end);
+    if (('\0' != *end) || (0.0 >= scale) || (1.0 < scale) ||
+        (outScales.end() !=
+         std::find(outScales.begin(), outScales.end(), scale))) {
+      return false;
+    }
+
+    outScales.push_back(scale);
+  }
+
+  std::sort(outScales.begin(), outScales.end(), std::greater<double>());
+  return !outScales.empty();
+}
+
+void LodBuilder::downscale(const RgbaImage& image, const int32_t width,
+                           const int32_t height, RgbaImage& outImage) {
+  const auto tapsX = computeTaps(static_cast<int32_t>(image.width), width);
+  const auto tapsY = computeTaps(static_cast<int32_t>(image.height), height);
+
+  // horizontal pass into alpha premultiplied floats
+  std::vector<float> rows(static_cast<size_t>(width) * image.height *
+                          RgbaImage::CHANNELS);
+  for (uint32_t y = 0; y < image.height; ++y) {
+    const uint8_t* srcRow = &image.pixels[static_cast<size_t>(y) *
+        image.width * RgbaImage::CHANNELS];
+    float* dstRow = &rows[static_cast<size_t>(y) * width *
+                          RgbaImage::CHANNELS];
+
+    for (int32_t x = 0; x < width; ++x) {
+      float* dstPixel = dstRow + (static_cast<size_t>(x) *
+                                  RgbaImage::CHANNELS);
+      for (const FilterTap& tap : tapsX[x]) {
+        const uint8_t* srcPixel = srcRow + (static_cast<size_t>(tap.srcIdx) *
+                                            RgbaImage::CHANNELS);
+        const float alphaWeight = tap.weight * srcPixel[ALPHA_CHANNEL];
+        for (int32_t channel = 0; channel < COLOR_CHANNELS; ++channel) {
+          dstPixel[channel] += alphaWeight * srcPixel[channel];
+        }
+        dstPixel[ALPHA_CHANNEL] += alphaWeight;
+      }
+    }
+  }
+
+  // vertical pass and conversion back to straight alpha
+  outImage.width = static_cast<uint32_t>(width);
+  outImage.height = static_cast<uint32_t>(height);
+  outImage.pixels.assign(static_cast<size_t>(width) * height *
+                         RgbaImage::CHANNELS, 0);
+  float pixel[RgbaImage::CHANNELS];
+  for (int32_t y = 0; y < height; ++y) {
+    for (int32_t x = 0; x < width; ++x) {
+      std::fill(std::begin(pixel), std::end(pixel), 0.0f);
+      for (const FilterTap& tap : tapsY[y]) {
+        const float* srcPixel = &rows[((static_cast<size_t>(tap.srcIdx) *
+            width) + x) * RgbaImage::CHANNELS];
+        for (uint32_t channel = 0; channel < RgbaImage::CHANNELS; ++channel) {
+          pixel[channel] += tap.weight * srcPixel[channel];
+        }
+      }
+
+      uint8_t* dstPixel = &outImage.pixels[((static_cast<size_t>(y) *
+          width) + x) * RgbaImage::CHANNELS];
+      const float alpha = pixel[ALPHA_CHANNEL];
+      if (0.0f >= alpha) {
+        continue;
+      }
+
+      for (int32_t channel = 0; channel < COLOR_CHANNELS; ++channel) {
+        dstPixel[channel] = static_cast<uint8_t>(std::lround(
+            std::min(pixel[channel] / alpha, MAX_CHANNEL_VALUE)));
+      }
+      dstPixel[ALPHA_CHANNEL] = static_cast<uint8_t>(std::lround(
+          std::min(alpha, MAX_CHANNEL_VALUE)));
+    }
+  }
+}
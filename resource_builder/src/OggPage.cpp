@@ -0,0 +1,64 @@
+// Corresponding header
+#include "resource_builder/OggPage.h"
+
+// System headers
+#include <cstring>
+
+// Other libraries headers
+
+// Own components headers
+#include "resource_builder/ByteReader.h"
+#include "resource_builder/HashUtils.h"
+
+namespace {
+constexpr uint8_t OGG_CAPTURE_PATTERN[] = {'O', 'g', 'g', 'S'};
+constexpr size_t OGG_VERSION_OFFSET = 4;
+constexpr size_t OGG_HEADER_TYPE_OFFSET = 5;
+constexpr size_t OGG_GRANULE_OFFSET = 6;
+constexpr size_t OGG_SERIAL_OFFSET = 14;
+constexpr size_t OGG_CRC_OFFSET = 22;
+constexpr size_t OGG_SEGMENTS_COUNT_OFFSET = 26;
+constexpr uint8_t OGG_HEADER_TYPE_MASK = 0x07;
+}
+
+OggPageStatus OggPage::read(std::span<const uint8_t> data,
+                            OggPageInfo& outInfo) {
+  if ((HEADER_SIZE > data.size()) ||
+      (0 != memcmp(data.data(), OGG_CAPTURE_PATTERN,
+                   sizeof(OGG_CAPTURE_PATTERN))) ||
+      (0 != data[OGG_VERSION_OFFSET]) ||
+      (0 != (data[OGG_HEADER_TYPE_OFFSET] & ~OGG_HEADER_TYPE_MASK))) {
+    return OggPageStatus::INVALID_HEADER;
+  }
+
+  outInfo.headerType = data[OGG_HEADER_TYPE_OFFSET];
+  outInfo.granule = ByteReader::readLittleEndian64(data, OGG_GRANULE_OFFSET);
+  outInfo.serial = ByteReader::readLittleEndian32(data, OGG_SERIAL_OFFSET);
+  outInfo.storedCrc = ByteReader::readLittleEndian32(data, OGG_CRC_OFFSET);
+
+  const size_t segmentsCount = data[OGG_SEGMENTS_COUNT_OFFSET];
+  const size_t headerSize = HEADER_SIZE + segmentsCount;
+  if (headerSize > data.size()) {
+    return OggPageStatus::TRUNCATED_SEGMENT_TABLE;
+  }
+
+  size_t bodySize = 0;
+  for (size_t i = 0; i < segmentsCount; ++i) {
+    bodySize += data[HEADER_SIZE + i];
+  }
+  outInfo.size = headerSize + bodySize;
+  if (outInfo.size > data.size()) {
+    return OggPageStatus::TRUNCATED_PAGE;
+  }
+
+  // the CRC is calculated with a zeroed CRC field
+  const uint8_t zeroCrc[sizeof(uint32_t)] = {0};
+  uint32_t crc = HashUtils::crc32Ogg(data.data(), OGG_CRC_OFFSET);
+  crc = HashUtils::crc32Ogg(zeroCrc, sizeof(zeroCrc), crc);
+  crc = HashUtils::crc32Ogg(data.data() + OGG_SEGMENTS_COUNT_OFFSET,
+                            outInfo.size - OGG_SEGMENTS_COUNT_OFFSET, crc);
+  outInfo.computedCrc = crc;
+
+  return (outInfo.storedCrc == outInfo.computedCrc) ?
+      OggPageStatus::VALID : OggPageStatus::CRC_MISMATCH;
+}
@@ -0,0 +1,1021 @@
+// Corresponding header
+#include "resource_builder/PngCodec.h"
+
+// System headers
+#include <algorithm>
+#include <cstdlib>
+#include <cstring>
+#include <iterator>
+#include <utility>
+
+// Other libraries headers
+#include "utils/log/Log.h"
+
+// Own components headers
+#include "resource_builder/ByteReader.h"
+#include "resource_builder/HashUtils.h"
+
+namespace {
+constexpr uint8_t PNG_SIGNATURE[] = {
+    0x89, 'P', 'N', 'G', 0x0D, 0x0A, 0x1A, 0x0A };
+constexpr uint8_t PNG_BIT_DEPTH = 8;
+constexpr uint8_t PNG_COLOR_TYPE_RGBA = 6;
+constexpr uint32_t PNG_FILTERS_COUNT = 5;
+constexpr uint32_t PNG_MAX_DIMENSION = 0x7FFFFFFF;
+
+constexpr uint32_t ADLER_MODULO = 65521;
+
+constexpr uint32_t LZ_WINDOW_SIZE = 32768;
+constexpr uint32_t LZ_MIN_MATCH = 3;
+constexpr uint32_t LZ_MAX_MATCH = 258;
+constexpr uint32_t LZ_MAX_CHAIN = 64;
+constexpr uint32_t LZ_HASH_BITS = 15;
+constexpr uint32_t LZ_HASH_SIZE = 1U << LZ_HASH_BITS;
+
+constexpr uint32_t END_OF_BLOCK = 256;
+
+constexpr uint16_t LENGTH_BASE[] = {
+    3,  4,  5,  6,  7,  8,  9,  10, 11,  13,  15,  17,  19,  23, 27,
+    31, 35, 43, 51, 59, 67, 83, 99, 115, 131, 163, 195, 227, 258 };
+constexpr uint8_t LENGTH_EXTRA[] = {
+    0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 2, 2, 2,
+    2, 3, 3, 3, 3, 4, 4, 4, 4, 5, 5, 5, 5, 0 };
+constexpr uint16_t DISTANCE_BASE[] = {
+    1,    2,    3,    4,    5,    7,     9,     13,    17,  25,
+    33,   49,   65,   97,   129,  193,   257,   385,   513, 769,
+    1025, 1537, 2049, 3073, 4097, 6145, 8193, 12289, 16385, 24577 };
+constexpr uint8_t DISTANCE_EXTRA[] = {
+    0, 0, 0, 0, 1, 1, 2,  2,  3,  3,  4,  4,  5,  5,  6,
+    6, 7, 7, 8, 8, 9, 9, 10, 10, 11, 11, 12, 12, 13, 13 };
+
+/* LSB first bit writer, as required by deflate */
+class BitWriter {
+ public:
+  explicit BitWriter(std::vector<uint8_t>& out) : _out(out) {}
+
+  void writeBits(const uint32_t value, const uint32_t count) {
+    _bitBuffer |= static_cast<uint64_t>(value) << _bitCount;
+    _bitCount += count;
+    while (8 <= _bitCount) {
+      _out.push_back(static_cast<uint8_t>(_bitBuffer & 0xFFU));
+      _bitBuffer >>= 8;
+      _bitCount -= 8;
+    }
+  }
+
+  // huffman codes are stored starting from their most significant bit
+  void writeCode(const uint32_t code, const uint32_t length) {
+    uint32_t reversed = 0;
+    for (uint32_t i = 0; i < length; ++i) {
+      reversed |= ((code >> i) & 1U) << (length - 1 - i);
+    }
+    writeBits(reversed, length);
+  }
+
+  void flush() {
+    if (0 != _bitCount) {
+      _out.push_back(static_cast<uint8_t>(_bitBuffer & 0xFFU));
+    }
+    _bitBuffer = 0;
+    _bitCount = 0;
+  }
+
+ private:
+  std::vector<uint8_t>& _out;
+  uint64_t _bitBuffer = 0;
+  uint32_t _bitCount = 0;
+};
+
+void writeLiteralLengthSymbol(BitWriter& writer, const uint32_t symbol) {
+  if (143 >= symbol) {
+    writer.writeCode(0x30 + symbol, 8);
+  } else if (255 >= symbol) {
+    writer.writeCode(0x190 + (symbol - 144), 9);
+  } else if (279 >= symbol) {
+    writer.writeCode(symbol - 256, 7);
+  } else {
+    writer.writeCode(0xC0 + (symbol - 280), 8);
+  }
+}
+
+void writeMatch(BitWriter& writer, const uint32_t length,
+                const uint32_t distance) {
+  uint32_t lengthIdx = sizeof(LENGTH_BASE) / sizeof(LENGTH_BASE[0]) - 1;
+  while (LENGTH_BASE[lengthIdx] > length) {
+    --lengthIdx;
+  }
+  writeLiteralLengthSymbol(writer, 257 + lengthIdx);
+  writer.writeBits(length - LENGTH_BASE[lengthIdx], LENGTH_EXTRA[lengthIdx]);
+
+  uint32_t distanceIdx = sizeof(DISTANCE_BASE) / sizeof(DISTANCE_BASE[0]) - 1;
+  while (DISTANCE_BASE[distanceIdx] > distance) {
+    --distanceIdx;
+  }
+  writer.writeCode(distanceIdx, 5);
+  writer.writeBits(distance - DISTANCE_BASE[distanceIdx],
+                   DISTANCE_EXTRA[distanceIdx]);
+}
+
+uint32_t hashTriplet(const uint8_t* data) {
+  const uint32_t value = (static_cast<uint32_t>(data[0]) << 16) |
+                         (static_cast<uint32_t>(data[1]) << 8) | data[2];
+  return (value * 2654435761U) >> (32 - LZ_HASH_BITS);
+}
+
+/** @brief used to compress data into a single fixed Huffman codes
+ *                       deflate block, using greedy LZ77 matching.
+ * */
+void deflateFixed(const std::vector<uint8_t>& data,
+                  std::vector<uint8_t>& outData) {
+  BitWriter writer(outData);
+  writer.writeBits(1, 1);  // BFINAL
+  writer.writeBits(1, 2);  // BTYPE - fixed Huffman codes
+
+  const uint32_t size = static_cast<uint32_t>(data.size());
+  std::vector<int32_t> head(LZ_HASH_SIZE, -1);
+  std::vector<int32_t> prev(size, -1);
+
+  auto insert = [&](const uint32_t pos) {
+    if (pos + LZ_MIN_MATCH <= size) {
+      const uint32_t hash = hashTriplet(&data[pos]);
+      prev[pos] = head[hash];
+      head[hash] = static_cast<int32_t>(pos);
+    }
+  };
+
+  uint32_t pos = 0;
+  while (pos < size) {
+    uint32_t bestLength = 0;
+    uint32_t bestDistance = 0;
+
+    if (pos + LZ_MIN_MATCH <= size) {
+      const uint32_t maxLength = std::min(LZ_MAX_MATCH, size - pos);
+      int32_t candidate = head[hashTriplet(&data[pos])];
+      for (uint32_t chain = 0; (0 <= candidate) && (chain < LZ_MAX_CHAIN);
+           ++chain) {
+        const uint32_t distance = pos - static_cast<uint32_t>(candidate);
+        if (LZ_WINDOW_SIZE < distance) {
+          break;
+        }
+
+        uint32_t length = 0;
+        while ((length < maxLength) &&
+               (data[candidate + length] == data[pos + length])) {
+          ++length;
+        }
+
+        if (length > bestLength) {
+          bestLength = length;
+          bestDistance = distance;
+          if (maxLength == length) {
+            break;
+          }
+        }
+        candidate = prev[candidate];
+      }
+    }
+
+    if (LZ_MIN_MATCH <= bestLength) {
+      writeMatch(writer, bestLength, bestDistance);
+      for (uint32_t i = 0; i < bestLength; ++i) {
+        insert(pos + i);
+      }
+      pos += bestLength;
+    } else {
+      writeLiteralLengthSymbol(writer, data[pos]);
+      insert(pos);
+      ++pos;
+    }
+  }
+
+  writeLiteralLengthSymbol(writer, END_OF_BLOCK);
+  writer.flush();
+}
+
+uint32_t adler32(const std::vector<uint8_t>& data) {
+  uint32_t a = 1;
+  uint32_t b = 0;
+  for (const uint8_t byte : data) {
+    a = (a + byte) % ADLER_MODULO;
+    b = (b + a) % ADLER_MODULO;
+  }
+
+  return (b << 16) | a;
+}
+
+void appendBigEndian32(std::vector<uint8_t>& out, const uint32_t value) {
+  out.push_back(static_cast<uint8_t>(value >> 24));
+  out.push_back(static_cast<uint8_t>(value >> 16));
+  out.push_back(static_cast<uint8_t>(value >> 8));
+  out.push_back(static_cast<uint8_t>(value));
+}
+
+void appendChunk(std::vector<uint8_t>& out, const char* type,
+                 const std::vector<uint8_t>& data) {
+  appendBigEndian32(out, static_cast<uint32_t>(data.size()));
+
+  const size_t typePos = out.size();
+  out.insert(out.end(), type, type + 4);
+  out.insert(out.end(), data.begin(), data.end());
+
+  // CRC covers the chunk type and the chunk data
+  appendBigEndian32(out, HashUtils::crc32(&out[typePos], out.size() - typePos));
+}
+
+uint8_t paethPredictor(const int32_t left, const int32_t up,
+                       const int32_t upLeft) {
+  const int32_t estimate = left + up - upLeft;
+  const int32_t leftDistance = std::abs(estimate - left);
+  const int32_t upDistance = std::abs(estimate - up);
+  const int32_t upLeftDistance = std::abs(estimate - upLeft);
+  if ((leftDistance <= upDistance) && (leftDistance <= upLeftDistance)) {
+    return static_cast<uint8_t>(left);
+  }
+
+  return static_cast<uint8_t>((upDistance <= upLeftDistance) ? up : upLeft);
+}
+
+/** @brief used to filter all image rows, choosing the filter with
+ *         the minimum sum of absolute differences for every row.
+ * */
+void filterRows(const RgbaImage& image, std::vector<uint8_t>& outData) {
+  const size_t stride = static_cast<size_t>(image.width) * RgbaImage::CHANNELS;
+  const std::vector<uint8_t> zeroRow(stride, 0);
+  std::vector<uint8_t> candidates[PNG_FILTERS_COUNT];
+  for (auto& candidate : candidates) {
+    candidate.resize(stride);
+  }
+
+  outData.reserve((stride + 1) * image.height);
+  for (uint32_t y = 0; y < image.height; ++y) {
+    const uint8_t* row = &image.pixels[y * stride];
+    const uint8_t* upRow = (0 == y) ? zeroRow.data() : row - stride;
+
+    for (size_t x = 0; x < stride; ++x) {
+      const uint8_t left = (RgbaImage::CHANNELS <= x)
+          ? row[x - RgbaImage::CHANNELS] : 0;
+      const uint8_t upLeft = (RgbaImage::CHANNELS <= x)
+          ? upRow[x - RgbaImage::CHANNELS] : 0;
+      const uint8_t up = upRow[x];
+
+      candidates[0][x] = row[x];
+      candidates[1][x] = static_cast<uint8_t>(row[x] - left);
+      candidates[2][x] = static_cast<uint8_t>(row[x] - up);
+      candidates[3][x] = static_cast<uint8_t>(row[x] - ((left + up) / 2));
+      candidates[4][x] = static_cast<uint8_t>(
+          row[x] - paethPredictor(left, up, upLeft));
+    }
+
+    uint32_t bestFilter = 0;
+    uint64_t bestSum = UINT64_MAX;
+    for (uint32_t filter = 0; filter < PNG_FILTERS_COUNT; ++filter) {
+      uint64_t sum = 0;
+      for (const uint8_t value : candidates[filter]) {
+        sum += static_cast<uint64_t>(std::abs(static_cast<int8_t>(value)));
+      }
+      if (sum < bestSum) {
+        bestSum = sum;
+        bestFilter = filter;
+      }
+    }
+
+    outData.push_back(static_cast<uint8_t>(bestFilter));
+    outData.insert(outData.end(), candidates[bestFilter].begin(),
+                   candidates[bestFilter].end());
+  }
+}
+
+constexpr uint32_t HUFFMAN_MAX_BITS = 15;
+constexpr uint32_t HUFFMAN_FAST_BITS = 9;
+constexpr uint32_t LITERAL_LENGTH_CODES = 288;
+constexpr uint32_t DISTANCE_CODES = 30;
+constexpr uint32_t CODE_LENGTH_CODES = 19;
+constexpr uint8_t CODE_LENGTH_ORDER[CODE_LENGTH_CODES] = {
+    16, 17, 18, 0, 8, 7, 9, 6, 10, 5, 11, 4, 12, 3, 13, 2, 14, 1, 15 };
+
+constexpr uint8_t PNG_COLOR_TYPE_GRAY = 0;
+constexpr uint8_t PNG_COLOR_TYPE_RGB = 2;
+constexpr uint8_t PNG_COLOR_TYPE_PALETTE = 3;
+constexpr uint8_t PNG_COLOR_TYPE_GRAY_ALPHA = 4;
+constexpr size_t PNG_CHUNK_OVERHEAD = 12;
+constexpr size_t PNG_IHDR_SIZE = 13;
+constexpr uint32_t ADAM7_PASSES = 7;
+
+// x start, y start, x step, y step
+constexpr uint32_t ADAM7_PATTERN[ADAM7_PASSES][4] = {
+    { 0, 0, 8, 8 }, { 4, 0, 8, 8 }, { 0, 4, 4, 8 }, { 2, 0, 4, 4 },
+    { 0, 2, 2, 4 }, { 1, 0, 2, 2 }, { 0, 1, 1, 2 } };
+
+// decoded images larger than this are rejected (decompression bombs)
+constexpr uint64_t PNG_MAX_DECODED_SIZE = 1ULL << 32;
+
+/* LSB first bit reader, as required by deflate.
+ * Reads past the end produce zero bits and are reported by isOverrun() */
+class BitReader {
+ public:
+  BitReader(const uint8_t* data, const size_t size)
+      : _data(data), _size(size) {}
+
+  uint32_t peekBits(const uint32_t count) {
+    refill();
+    return static_cast<uint32_t>(_bitBuffer & ((1ULL << count) - 1));
+  }
+
+  void consumeBits(const uint32_t count) {
+    _bitBuffer >>= count;
+    _bitCount -= count;
+  }
+
+  uint32_t readBits(const uint32_t count) {
+    const uint32_t value = peekBits(count);
+    consumeBits(count);
+    return value;
+  }
+
+  void alignToByte() {
+    consumeBits(_bitCount % 8);
+  }
+
+  bool isOverrun() const {
+    return ((_pos * 8) - _bitCount) > (_size * 8);
+  }
+
+ private:
+  void refill() {
+    while (56 >= _bitCount) {
+      const uint64_t byte = (_pos < _size) ? _data[_pos] : 0;
+      _bitBuffer |= byte << _bitCount;
+      _bitCount += 8;
+      ++_pos;
+    }
+  }
+
+  const uint8_t* _data;
+  size_t _size;
+  size_t _pos = 0;
+  uint64_t _bitBuffer = 0;
+  uint32_t _bitCount = 0;
+};
+
+/* Canonical Huffman decoding table. Codes up to HUFFMAN_FAST_BITS long
+ * are resolved with a single lookup, the longer ones bit by bit */
+class HuffmanTable {
+ public:
+  bool build(const uint8_t* lengths, const uint32_t symbolsCount) {
+    std::fill(std::begin(_counts), std::end(_counts), 0);
+    std::fill(std::begin(_fastLookup), std::end(_fastLookup), 0);
+    _symbols.assign(symbolsCount, 0);
+
+    for (uint32_t symbol = 0; symbol < symbolsCount; ++symbol) {
+      ++_counts[lengths[symbol]];
+    }
+
+    // over-subscribed codes are invalid. Incomplete codes are allowed
+    int32_t left = 1;
+    for (uint32_t len = 1; len <= HUFFMAN_MAX_BITS; ++len) {
+      left = (left * 2) - _counts[len];
+      if (0 > left) {
+        return false;
+      }
+    }
+
+    uint16_t offsets[HUFFMAN_MAX_BITS + 1] = { 0 };
+    for (uint32_t len = 1; len < HUFFMAN_MAX_BITS; ++len) {
+      offsets[len + 1] = static_cast<uint16_t>(offsets[len] + _counts[len]);
+    }
+    for (uint32_t symbol = 0; symbol < symbolsCount; ++symbol) {
+      if (0 != lengths[symbol]) {
+        _symbols[offsets[lengths[symbol]]++] = static_cast<uint16_t>(symbol);
+      }
+    }
+
+    uint32_t code = 0;
+    uint32_t idx = 0;
+    for (uint32_t len = 1; len <= HUFFMAN_MAX_BITS; ++len) {
+      for (uint32_t i = 0; i < _counts[len]; ++i, ++code, ++idx) {
+        if (HUFFMAN_FAST_BITS < len) {
+          continue;
+        }
+
+        uint32_t reversed = 0;
+        for (uint32_t bit = 0; bit < len; ++bit) {
+          reversed |= ((code >> bit) & 1U) << (len - 1 - bit);
+        }
+        const uint16_t entry =
+            static_cast<uint16_t>((_symbols[idx] << 4) | len);
+        for (uint32_t fill = reversed; fill < (1U << HUFFMAN_FAST_BITS);
+             fill += (1U << len)) {
+          _fastLookup[fill] = entry;
+        }
+      }
+      code <<= 1;
+    }
+
+    return true;
+  }
+
+  /* returns -1 on invalid code */
+  int32_t decode(BitReader& reader) const {
+    const uint16_t entry = _fastLookup[reader.peekBits(HUFFMAN_FAST_BITS)];
+    if (0 != entry) {
+      reader.consumeBits(entry & 0xFU);
+      return entry >> 4;
+    }
+
+    int32_t code = 0;
+    int32_t first = 0;
+    int32_t idx = 0;
+    for (uint32_t len = 1; len <= HUFFMAN_MAX_BITS; ++len) {
+      code |= static_cast<int32_t>(reader.readBits(1));
+      const int32_t count = _counts[len];
+      if ((code - count) < first) {
+        return _symbols[static_cast<size_t>(idx + (code - first))];
+      }
+      idx += count;
+      first = (first + count) << 1;
+      code <<= 1;
+    }
+
+    return -1;
+  }
+
+ private:
+  uint16_t _counts[HUFFMAN_MAX_BITS + 1] = { 0 };
+  uint16_t _fastLookup[1U << HUFFMAN_FAST_BITS] = { 0 };
+  std::vector<uint16_t> _symbols;
+};
+
+bool inflateBlock(BitReader& reader, const HuffmanTable& literalLengths,
+                  const HuffmanTable& distances, const size_t maxSize,
+                  std::vector<uint8_t>& outData) {
+  while (true) {
+    const int32_t symbol = literalLengths.decode(reader);
+    if (0 > symbol) {
+      return false;
+    }
+
+    if (END_OF_BLOCK > static_cast<uint32_t>(symbol)) {
+      if (maxSize <= outData.size()) {
+        return false;
+      }
+      outData.push_back(static_cast<uint8_t>(symbol));
+      continue;
+    }
+
+    if (END_OF_BLOCK == static_cast<uint32_t>(symbol)) {
+      return !reader.isOverrun();
+    }
+
+    const uint32_t lengthIdx = static_cast<uint32_t>(symbol) - 257;
+    if (std::size(LENGTH_BASE) <= lengthIdx) {
+      return false;
+    }
+    const uint32_t length = LENGTH_BASE[lengthIdx] +
+                            reader.readBits(LENGTH_EXTRA[lengthIdx]);
+
+    const int32_t distanceIdx = distances.decode(reader);
+    if ((0 > distanceIdx) ||
+        (std::size(DISTANCE_BASE) <= static_cast<size_t>(distanceIdx))) {
+      return false;
+    }
+    const size_t distance = DISTANCE_BASE[distanceIdx] +
+                            reader.readBits(DISTANCE_EXTRA[distanceIdx]);
+
+    if ((distance > outData.size()) ||
+        ((outData.size() + length) > maxSize)) {
+      return false;
+    }
+
+    // matches may overlap with the bytes they produce
+    const size_t from = outData.size() - distance;
+    for (size_t i = 0; i < length; ++i) {
+      outData.push_back(outData[from + i]);
+    }
+  }
+}
+
+bool buildDynamicTables(BitReader& reader, HuffmanTable& outLiteralLengths,
+                        HuffmanTable& outDistances) {
+  const uint32_t literalLengthsCount = reader.readBits(5) + 257;
+  const uint32_t distancesCount = reader.readBits(5) + 1;
+  const uint32_t codeLengthsCount = reader.readBits(4) + 4;
+  if ((286 < literalLengthsCount) || (DISTANCE_CODES < distancesCount)) {
+    return false;
+  }
+
+  uint8_t codeLengths[CODE_LENGTH_CODES] = { 0 };
+  for (uint32_t i = 0; i < codeLengthsCount; ++i) {
+    codeLengths[CODE_LENGTH_ORDER[i]] = static_cast<uint8_t>(reader.readBits(3));
+  }
+
+  HuffmanTable codeLengthTable;
+  if (!codeLengthTable.build(codeLengths, CODE_LENGTH_CODES)) {
+    return false;
+  }
+
+  uint8_t lengths[LITERAL_LENGTH_CODES + DISTANCE_CODES] = { 0 };
+  const uint32_t lengthsCount = literalLengthsCount + distancesCount;
+  uint32_t idx = 0;
+  while (idx < lengthsCount) {
+    const int32_t symbol = codeLengthTable.decode(reader);
+    if (0 > symbol) {
+      return false;
+    }
+
+    if (16 > symbol) {
+      lengths[idx++] = static_cast<uint8_t>(symbol);
+      continue;
+    }
+
+    uint8_t value = 0;
+    uint32_t repeats = 0;
+    if (16 == symbol) {
+      if (0 == idx) {
+        return false;
+      }
+      value = lengths[idx - 1];
+      repeats = 3 + reader.readBits(2);
+    } else if (17 == symbol) {
+      repeats = 3 + reader.readBits(3);
+    } else {
+      repeats = 11 + reader.readBits(7);
+    }
+
+    if ((idx + repeats) > lengthsCount) {
+      return false;
+    }
+    while (0 < repeats--) {
+      lengths[idx++] = value;
+    }
+  }
+
+  // the end of block code is mandatory
+  if (0 == lengths[END_OF_BLOCK]) {
+    return false;
+  }
+
+  return outLiteralLengths.build(lengths, literalLengthsCount) &&
+         outDistances.build(lengths + literalLengthsCount, distancesCount);
+}
+
+/** @brief used to decompress a zlib stream.
+ *
+ *  @returns bool - is the stream valid and within maxSize or not
+ * */
+bool inflateZlib(const std::vector<uint8_t>& data, const size_t maxSize,
+                 std::vector<uint8_t>& outData) {
+  constexpr uint32_t ZLIB_DEFLATE_METHOD = 8;
+  constexpr uint32_t ZLIB_PRESET_DICTIONARY = 0x20;
+  constexpr size_t ZLIB_OVERHEAD = 6;
+
+  if ((ZLIB_OVERHEAD > data.size()) ||
+      (ZLIB_DEFLATE_METHOD != (data[0] & 0x0FU)) ||
+      (0 != (((data[0] << 8) | data[1]) % 31)) ||
+      (0 != (data[1] & ZLIB_PRESET_DICTIONARY))) {
+    return false;
+  }
+
+  static const auto fixedTables = []() {
+    uint8_t lengths[LITERAL_LENGTH_CODES + DISTANCE_CODES];
+    std::fill(lengths, lengths + 144, 8);
+    std::fill(lengths + 144, lengths + 256, 9);
+    std::fill(lengths + 256, lengths + 280, 7);
+    std::fill(lengths + 280, lengths + LITERAL_LENGTH_CODES, 8);
+    std::fill(lengths + LITERAL_LENGTH_CODES, std::end(lengths), 5);
+
+    std::pair<HuffmanTable, HuffmanTable> tables;
+    tables.first.build(lengths, LITERAL_LENGTH_CODES);
+    tables.second.build(lengths + LITERAL_LENGTH_CODES, DISTANCE_CODES);
+    return tables;
+  }();
+
+  outData.clear();
+  BitReader reader(data.data() + 2, data.size() - ZLIB_OVERHEAD);
+  HuffmanTable literalLengths;
+  HuffmanTable distances;
+  uint32_t isFinalBlock = 0;
+  while (0 == isFinalBlock) {
+    isFinalBlock = reader.readBits(1);
+    const uint32_t blockType = reader.readBits(2);
+
+    bool success = false;
+    if (0 == blockType) {
+      reader.alignToByte();
+      const uint32_t length = reader.readBits(16);
+      const uint32_t lengthComplement = reader.readBits(16);
+      success = (length == (~lengthComplement & 0xFFFFU)) &&
+                ((outData.size() + length) <= maxSize);
+      for (uint32_t i = 0; success && (i < length); ++i) {
+        outData.push_back(static_cast<uint8_t>(reader.readBits(8)));
+      }
+      success = success && !reader.isOverrun();
+    } else if (1 == blockType) {
+      success = inflateBlock(reader, fixedTables.first, fixedTables.second,
+                             maxSize, outData);
+    } else if (2 == blockType) {
+      success = buildDynamicTables(reader, literalLengths, distances) &&
+                inflateBlock(reader, literalLengths, distances, maxSize,
+                             outData);
+    }
+
+    if (!success) {
+      return false;
+    }
+  }
+
+  const uint32_t expectedAdler =
+      ByteReader::readBigEndian32(data, data.size() - 4);
+
+  return expectedAdler == adler32(outData);
+}
+
+/* PNG image header and the color related ancillary data */
+struct PngHeader {
+  uint32_t width = 0;
+  uint32_t height = 0;
+  uint32_t bitDepth = 0;
+  uint32_t colorType = 0;
+  uint32_t interlaceMethod = 0;
+  uint32_t channels = 0;
+
+  /* 'PLTE' entries, expanded to RGBA with the 'tRNS' alpha values */
+  std::vector<uint8_t> palette;
+
+  /* 'tRNS' transparent color for gray and RGB images */
+  bool hasTransparentColor = false;
+  uint32_t transparentColor[3] = { 0, 0, 0 };
+};
+
+uint32_t getChannelsCount(const uint32_t colorType) {
+  switch (colorType) {
+    case PNG_COLOR_TYPE_GRAY:
+    case PNG_COLOR_TYPE_PALETTE:
+      return 1;
+    case PNG_COLOR_TYPE_GRAY_ALPHA:
+      return 2;
+    case PNG_COLOR_TYPE_RGB:
+      return 3;
+    case PNG_COLOR_TYPE_RGBA:
+      return 4;
+    default:
+      return 0;
+  }
+}
+
+bool isValidBitDepth(const uint32_t colorType, const uint32_t bitDepth) {
+  switch (colorType) {
+    case PNG_COLOR_TYPE_GRAY:
+      return (1 == bitDepth) || (2 == bitDepth) || (4 == bitDepth) ||
+             (8 == bitDepth) || (16 == bitDepth);
+    case PNG_COLOR_TYPE_PALETTE:
+      return (1 == bitDepth) || (2 == bitDepth) || (4 == bitDepth) ||
+             (8 == bitDepth);
+    default:
+      return (8 == bitDepth) || (16 == bitDepth);
+  }
+}
+
+uint32_t readSample(const uint8_t* row, const size_t sampleIdx,
+                    const uint32_t bitDepth) {
+  if (16 == bitDepth) {
+    return static_cast<uint32_t>((row[2 * sampleIdx] << 8) |
+                                 row[(2 * sampleIdx) + 1]);
+  }
+  if (8 == bitDepth) {
+    return row[sampleIdx];
+  }
+
+  const size_t bitPos = sampleIdx * bitDepth;
+  const uint32_t shift = 8 - bitDepth - static_cast<uint32_t>(bitPos % 8);
+  return (row[bitPos / 8] >> shift) & ((1U << bitDepth) - 1);
+}
+
+/** @brief used to convert a single unfiltered scanline to RGBA pixels
+ * */
+void convertRow(const PngHeader& header, const uint8_t* row,
+                const uint32_t pixelsCount, uint8_t* outPixels,
+                const size_t outPixelStride) {
+  const uint32_t maxValue = (1U << header.bitDepth) - 1;
+  auto toByte = [&header, maxValue](const uint32_t sample) {
+    if (16 == header.bitDepth) {
+      return static_cast<uint8_t>(sample >> 8);
+    }
+    return static_cast<uint8_t>((sample * 255) / maxValue);
+  };
+
+  for (uint32_t x = 0; x < pixelsCount; ++x) {
+    uint8_t* pixel = outPixels + (x * outPixelStride);
+    const size_t sampleIdx = static_cast<size_t>(x) * header.channels;
+
+    if (PNG_COLOR_TYPE_PALETTE == header.colorType) {
+      const size_t entry = readSample(row, sampleIdx, header.bitDepth);
+      if ((entry * RgbaImage::CHANNELS) < header.palette.size()) {
+        std::copy_n(&header.palette[entry * RgbaImage::CHANNELS],
+                    RgbaImage::CHANNELS, pixel);
+      } else {
+        std::fill_n(pixel, RgbaImage::CHANNELS, 0);
+      }
+      continue;
+    }
+
+    uint32_t samples[4] = { 0, 0, 0, maxValue };
+    for (uint32_t channel = 0; channel < header.channels; ++channel) {
+      samples[channel] =
+          readSample(row, sampleIdx + channel, header.bitDepth);
+    }
+
+    bool isTransparent = false;
+    if ((PNG_COLOR_TYPE_GRAY == header.colorType) ||
+        (PNG_COLOR_TYPE_GRAY_ALPHA == header.colorType)) {
+      isTransparent = header.hasTransparentColor &&
+                      (samples[0] == header.transparentColor[0]);
+      samples[3] = (PNG_COLOR_TYPE_GRAY_ALPHA == header.colorType)
+          ? samples[1] : maxValue;
+      samples[1] = samples[0];
+      samples[2] = samples[0];
+    } else if (PNG_COLOR_TYPE_RGB == header.colorType) {
+      isTransparent = header.hasTransparentColor &&
+                      (samples[0] == header.transparentColor[0]) &&
+                      (samples[1] == header.transparentColor[1]) &&
+                      (samples[2] == header.transparentColor[2]);
+    }
+
+    pixel[0] = toByte(samples[0]);
+    pixel[1] = toByte(samples[1]);
+    pixel[2] = toByte(samples[2]);
+    pixel[3] = isTransparent ? 0 : toByte(samples[3]);
+  }
+}
+
+/** @brief used to reverse the row filters of a single (sub)image
+ * */
+bool unfilterRows(const uint8_t* data, const size_t stride,
+                  const uint32_t rowsCount, const size_t bytesPerPixel,
+                  std::vector<uint8_t>& outRows) {
+  outRows.assign(stride * rowsCount, 0);
+  for (uint32_t y = 0; y < rowsCount; ++y) {
+    const uint8_t filter = data[y * (stride + 1)];
+    const uint8_t* in = &data[(y * (stride + 1)) + 1];
+    uint8_t* row = &outRows[y * stride];
+    const uint8_t* upRow = (0 == y) ? nullptr : row - stride;
+
+    for (size_t x = 0; x < stride; ++x) {
+      const int32_t left = (bytesPerPixel <= x) ? row[x - bytesPerPixel] : 0;
+      const int32_t up = upRow ? upRow[x] : 0;
+      const int32_t upLeft =
+          (upRow && (bytesPerPixel <= x)) ? upRow[x - bytesPerPixel] : 0;
+
+      int32_t predictor = 0;
+      switch (filter) {
+        case 0:
+          break;
+        case 1:
+          predictor = left;
+          break;
+        case 2:
+          predictor = up;
+          break;
+        case 3:
+          predictor = (left + up) / 2;
+          break;
+        case 4:
+          predictor = paethPredictor(left, up, upLeft);
+          break;
+        default:
+          return false;
+      }
+      row[x] = static_cast<uint8_t>(in[x] + predictor);
+    }
+  }
+
+  return true;
+}
+
+/** @brief used to read the chunks of a PNG file
+ *
+ *  @returns bool - is the chunk layout valid or not
+ * */
+bool readChunks(const std::vector<uint8_t>& data, PngHeader& outHeader,
+                std::vector<uint8_t>& outImageData) {
+  size_t pos = sizeof(PNG_SIGNATURE);
+  bool hasHeader = false;
+  std::vector<uint8_t> transparency;
+
+  while ((pos + PNG_CHUNK_OVERHEAD) <= data.size()) {
+    const uint32_t length = ByteReader::readBigEndian32(data, pos);
+    const uint8_t* type = &data[pos + 4];
+    const uint8_t* chunkData = &data[pos + 8];
+    if (length > (data.size() - pos - PNG_CHUNK_OVERHEAD)) {
+      LOGERR("Error, truncated PNG chunk");
+      return false;
+    }
+
+    const uint32_t expectedCrc =
+        ByteReader::readBigEndian32(data, pos + 8 + length);
+    if (expectedCrc != HashUtils::crc32(type, length + 4)) {
+      LOGERR("Error, PNG chunk: %.4s has invalid CRC", type);
+      return false;
+    }
+    pos += PNG_CHUNK_OVERHEAD + length;
+
+    if (0 == memcmp(type, "IHDR", 4)) {
+      if (PNG_IHDR_SIZE != length) {
+        return false;
+      }
+      outHeader.width = ByteReader::readBigEndian32({ chunkData, length });
+      outHeader.height =
+          ByteReader::readBigEndian32({ chunkData, length }, 4);
+      outHeader.bitDepth = chunkData[8];
+      outHeader.colorType = chunkData[9];
+      outHeader.interlaceMethod = chunkData[12];
+      outHeader.channels = getChannelsCount(outHeader.colorType);
+      hasHeader = (0 != outHeader.channels) &&
+                  isValidBitDepth(outHeader.colorType, outHeader.bitDepth) &&
+                  (0 == chunkData[10]) && (0 == chunkData[11]) &&
+                  (1 >= outHeader.interlaceMethod);
+      if (!hasHeader) {
+        LOGERR("Error, unsupported PNG IHDR parameters");
+        return false;
+      }
+    } else if (0 == memcmp(type, "PLTE", 4)) {
+      outHeader.palette.clear();
+      for (uint32_t i = 0; (i + 3) <= length; i += 3) {
+        outHeader.palette.insert(outHeader.palette.end(),
+                                 { chunkData[i], chunkData[i + 1],
+                                   chunkData[i + 2], 255 });
+      }
+    } else if (0 == memcmp(type, "tRNS", 4)) {
+      transparency.assign(chunkData, chunkData + length);
+    } else if (0 == memcmp(type, "IDAT", 4)) {
+      outImageData.insert(outImageData.end(), chunkData, chunkData + length);
+    } else if (0 == memcmp(type, "IEND", 4)) {
+      break;
+    }
+  }
+
+  if (!hasHeader || outImageData.empty()) {
+    LOGERR("Error, PNG has no IHDR or IDAT chunks");
+    return false;
+  }
+
+  if (PNG_COLOR_TYPE_PALETTE == outHeader.colorType) {
+    for (size_t i = 0; (i < transparency.size()) &&
+         ((i * RgbaImage::CHANNELS) < outHeader.palette.size()); ++i) {
+      outHeader.palette[(i * RgbaImage::CHANNELS) + 3] = transparency[i];
+    }
+  } else if ((PNG_COLOR_TYPE_GRAY == outHeader.colorType) &&
+             (2 <= transparency.size())) {
+    outHeader.hasTransparentColor = true;
+    outHeader.transparentColor[0] =
+        static_cast<uint32_t>((transparency[0] << 8) | transparency[1]);
+  } else if ((PNG_COLOR_TYPE_RGB == outHeader.colorType) &&
+             (6 <= transparency.size())) {
+    outHeader.hasTransparentColor = true;
+    for (uint32_t i = 0; i < 3; ++i) {
+      outHeader.transparentColor[i] = static_cast<uint32_t>(
+          (transparency[2 * i] << 8) | transparency[(2 * i) + 1]);
+    }
+  }
+
+  return true;
+}
+}
+
+ErrorCode PngCodec::encode(const RgbaImage& image,
+                           std::vector<uint8_t>& outData) {
+  if ((0 == image.width) || (0 == image.height) ||
+      (PNG_MAX_DIMENSION < image.width) || (PNG_MAX_DIMENSION < image.height) ||
+      (image.pixels.size() != static_cast<size_t>(image.width) *
+                              image.height * RgbaImage::CHANNELS)) {
+    LOGERR("Error, invalid image with dimensions: %ux%u", image.width,
+           image.height);
+    return ErrorCode::FAILURE;
+  }
+
+  std::vector<uint8_t> filteredData;
+  filterRows(image, filteredData);
+
+  // zlib stream: header, deflate data, adler32 of the uncompressed data
+  std::vector<uint8_t> zlibData = { 0x78, 0x01 };
+  deflateFixed(filteredData, zlibData);
+  appendBigEndian32(zlibData, adler32(filteredData));
+
+  std::vector<uint8_t> header;
+  appendBigEndian32(header, image.width);
+  appendBigEndian32(header, image.height);
+  header.push_back(PNG_BIT_DEPTH);
+  header.push_back(PNG_COLOR_TYPE_RGBA);
+  header.push_back(0);  // compression method
+  header.push_back(0);  // filter method
+  header.push_back(0);  // interlace method
+
+  outData.clear();
+  outData.insert(outData.end(), std::begin(PNG_SIGNATURE),
+                 std::end(PNG_SIGNATURE));
+  appendChunk(outData, "IHDR", header);
+  appendChunk(outData, "IDAT", zlibData);
+  appendChunk(outData, "IEND", {});
+
+  return ErrorCode::SUCCESS;
+}
+
+ErrorCode PngCodec::decode(const std::vector<uint8_t>& data,
+                           RgbaImage& outImage) {
+  if (!hasSignature(data)) {
+    LOGERR("Error, data has no PNG signature");
+    return ErrorCode::FAILURE;
+  }
+
+  PngHeader header;
+  std::vector<uint8_t> zlibData;
+  if (!readChunks(data, header, zlibData)) {
+    LOGERR("Error, invalid PNG chunks");
+    return ErrorCode::FAILURE;
+  }
+
+  const uint64_t decodedSize = static_cast<uint64_t>(header.width) *
+                               header.height * RgbaImage::CHANNELS;
+  if ((0 == decodedSize) || (PNG_MAX_DECODED_SIZE < decodedSize)) {
+    LOGERR("Error, unsupported PNG dimensions: %ux%u", header.width,
+           header.height);
+    return ErrorCode::FAILURE;
+  }
+
+  const uint32_t bitsPerPixel = header.channels * header.bitDepth;
+  const size_t bytesPerPixel = std::max<size_t>(1, bitsPerPixel / 8);
+  const uint32_t passesCount = (1 == header.interlaceMethod) ? ADAM7_PASSES : 1;
+  constexpr uint32_t NON_INTERLACED[4] = { 0, 0, 1, 1 };
+
+  // every pass is a standalone sub image with it's own filtered rows
+  auto getPassSize = [&](const uint32_t* pattern, uint32_t& outWidth,
+                         uint32_t& outHeight) {
+    outWidth = (header.width > pattern[0])
+        ? ((header.width - pattern[0] + pattern[2] - 1) / pattern[2]) : 0;
+    outHeight = (header.height > pattern[1])
+        ? ((header.height - pattern[1] + pattern[3] - 1) / pattern[3]) : 0;
+  };
+
+  size_t expectedSize = 0;
+  for (uint32_t pass = 0; pass < passesCount; ++pass) {
+    const uint32_t* pattern =
+        (1 == passesCount) ? NON_INTERLACED : ADAM7_PATTERN[pass];
+    uint32_t passWidth = 0;
+    uint32_t passHeight = 0;
+    getPassSize(pattern, passWidth, passHeight);
+    if ((0 != passWidth) && (0 != passHeight)) {
+      const size_t stride =
+          ((static_cast<size_t>(passWidth) * bitsPerPixel) + 7) / 8;
+      expectedSize += (stride + 1) * passHeight;
+    }
+  }
+
+  std::vector<uint8_t> filteredData;
+  filteredData.reserve(expectedSize);
+  if (!inflateZlib(zlibData, expectedSize, filteredData) ||
+      (expectedSize != filteredData.size())) {
+    LOGERR("Error, corrupted PNG image data");
+    return ErrorCode::FAILURE;
+  }
+
+  outImage.width = header.width;
+  outImage.height = header.height;
+  outImage.pixels.assign(static_cast<size_t>(decodedSize), 0);
+
+  std::vector<uint8_t> rows;
+  size_t passOffset = 0;
+  for (uint32_t pass = 0; pass < passesCount; ++pass) {
+    const uint32_t* pattern =
+        (1 == passesCount) ? NON_INTERLACED : ADAM7_PATTERN[pass];
+    uint32_t passWidth = 0;
+    uint32_t passHeight = 0;
+    getPassSize(pattern, passWidth, passHeight);
+    if ((0 == passWidth) || (0 == passHeight)) {
+      continue;
+    }
+
+    const size_t stride =
+        ((static_cast<size_t>(passWidth) * bitsPerPixel) + 7) / 8;
+    if (!unfilterRows(&filteredData[passOffset], stride, passHeight,
+                      bytesPerPixel, rows)) {
+      LOGERR("Error, invalid PNG row filter");
+      return ErrorCode::FAILURE;
+    }
+    passOffset += (stride + 1) * passHeight;
+
+    for (uint32_t y = 0; y < passHeight; ++y) {
+      const size_t outRow = pattern[1] + (static_cast<size_t>(y) * pattern[3]);
+      uint8_t* outPixels = &outImage.pixels[
+          ((outRow * header.width) + pattern[0]) * RgbaImage::CHANNELS];
+      convertRow(header, &rows[y * stride], passWidth, outPixels,
+                 pattern[2] * RgbaImage::CHANNELS);
+    }
+  }
+
+  return ErrorCode::SUCCESS;
+}
+
+bool PngCodec::hasSignature(const std::vector<uint8_t>& data) {
+  return (sizeof(PNG_SIGNATURE) <= data.size()) &&
+         std::equal(std::begin(PNG_SIGNATURE), std::end(PNG_SIGNATURE),
+                    data.begin());
+}
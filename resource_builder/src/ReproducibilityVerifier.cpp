@@ -0,0 +1,168 @@
+// Corresponding header
+#include "resource_builder/ReproducibilityVerifier.h"
+
+// System headers
+#include <algorithm>
+#include <chrono>
+#include <filesystem>
+#include <fstream>
+#include <iterator>
+#include <system_error>
+#include <vector>
+
+// Other libraries headers
+#include "utils/log/Log.h"
+
+// Own components headers
+#include "resource_builder/ResourceBuilderConfig.h"
+#include "resource_builder/ResourceParser.h"
+
+namespace {
+constexpr auto VERIFY_DIR_PREFIX = "resource_builder_verify_";
+
+/** @brief used to obtain the sorted list of all regular files
+ *                       (relative to the provided directory) in a tree.
+ * */
+std::vector<std::string> getRelativeFiles(const std::filesystem::path& dir) {
+  std::vector<std::string> files;
+  std::error_code errorCode;
+  for (const auto& entry :
+       std::filesystem::recursive_directory_iterator(dir, errorCode)) {
+    if (entry.is_regular_file(errorCode)) {
+      files.push_back(
+          std::filesystem::relative(entry.path(), dir, errorCode)
+              .generic_string());
+    }
+  }
+
+  std::sort(files.begin(), files.end());
+  return files;
+}
+
+/** @brief used to read the whole file content
+ * */
+bool readFile(const std::filesystem::path& fileName, std::string& outData) {
+  std::ifstream stream(fileName, std::ifstream::in | std::ifstream::binary);
+  if (!stream) {
+    return false;
+  }
+
+  outData.assign(std::istreambuf_iterator<char>(stream),
+                 std::istreambuf_iterator<char>());
+  return true;
+}
+}
+
+ErrorCode ReproducibilityVerifier::verify(
+    const ResourceBuilderConfig& config) {
+  LOG("======================================");
+  LOG("Verifying reproducibility of the produced outputs");
+
+  std::error_code errorCode;
+  const std::filesystem::path verifyDir =
+      std::filesystem::temp_directory_path(errorCode) /
+      (VERIFY_DIR_PREFIX + std::to_string(
+          std::chrono::steady_clock::now().time_since_epoch().count()));
+  if (errorCode) {
+    LOGERR("Error, could not obtain temporary directory, reason: %s",
+           errorCode.message().c_str());
+    return ErrorCode::FAILURE;
+  }
+
+  const std::string firstDir = (verifyDir / "first").string();
+  const std::string secondDir = (verifyDir / "second").string();
+
+  auto err = buildInto(config, firstDir);
+  if (ErrorCode::SUCCESS == err) {
+    err = buildInto(config, secondDir);
+  }
+
+  if (ErrorCode::SUCCESS == err) {
+    err = compareTrees(firstDir, secondDir);
+  }
+
+  std::filesystem::remove_all(verifyDir, errorCode);
+
+  LOG_ON_SAME_LINE("Reproducibility verification ... ");
+  if (ErrorCode::SUCCESS == err) {
+    LOGG("[Done]");
+  } else {
+    LOGR("[Failed]");
+  }
+  LOG("======================================");
+
+  return err;
+}
+
+ErrorCode ReproducibilityVerifier::buildInto(
+    const ResourceBuilderConfig& config, const std::string& outputDir) {
+  ResourceBuilderConfig verifyConfig = config;
+  verifyConfig.outputDir = outputDir;
+  verifyConfig.verifyReproducible = false;
+  // durability is irrelevant for throwaway outputs
+  verifyConfig.syncOutputFiles = false;
+
+  ResourceParser parser;
+  if (ErrorCode::SUCCESS != parser.init(verifyConfig)) {
+    LOGERR("Error in parser.init()");
+    return ErrorCode::FAILURE;
+  }
+
+  for (const auto& project : verifyConfig.projectNames) {
+    if (ErrorCode::SUCCESS != parser.parseResourceTree(project)) {
+      LOGERR("Error in parser.parseResourceTree() for project: %s",
+             project.c_str());
+      return ErrorCode::FAILURE;
+    }
+  }
+
+  return ErrorCode::SUCCESS;
+}
+
+ErrorCode ReproducibilityVerifier::compareTrees(const std::string& firstDir,
+                                                const std::string& secondDir) {
+  const std::vector<std::string> firstFiles = getRelativeFiles(firstDir);
+  const std::vector<std::string> secondFiles = getRelativeFiles(secondDir);
+
+  auto err = ErrorCode::SUCCESS;
+  std::vector<std::string> unmatchedFiles;
+  std::set_symmetric_difference(firstFiles.begin(), firstFiles.end(),
+                                secondFiles.begin(), secondFiles.end(),
+                                std::back_inserter(unmatchedFiles));
+  for (const auto& file : unmatchedFiles) {
+    LOGERR("Error, %s is produced by only one of the builds", file.c_str());
+    err = ErrorCode::FAILURE;
+  }
+
+  std::string firstData;
+  std::string secondData;
+  for (const auto& file : firstFiles) {
+    if (!std::binary_search(secondFiles.begin(), secondFiles.end(), file)) {
+      continue;
+    }
+
+    if (!readFile(std::filesystem::path(firstDir) / file, firstData) ||
+        !readFile(std::filesystem::path(secondDir) / file, secondData)) {
+      LOGERR("Error, could not read %s", file.c_str());
+      err = ErrorCode::FAILURE;
+      continue;
+    }
+
+    if (firstData == secondData) {
+      continue;
+    }
+
+    const auto mismatch = std::mismatch(firstData.begin(), firstData.end(),
+                                        secondData.begin(), secondData.end());
+    LOGERR("Error, %s differs between the builds at byte offset: %zu",
+           file.c_str(),
+           static_cast<size_t>(mismatch.first - firstData.begin()));
+    err = ErrorCode::FAILURE;
+  }
+
+  if (ErrorCode::SUCCESS == err) {
+    LOG("Compared %zu files - outputs are byte-identical", firstFiles.size());
+  }
+
+  return err;
+}
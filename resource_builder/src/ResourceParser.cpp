@@ -2,8 +2,10 @@
 #include "resource_builder/ResourceParser.h"
 
 // System headers
+#include <algorithm>
 #include <cctype>
-#include <functional>  //for std::hash
+#include <cmath>
+#include <filesystem>
 
 // Other libraries headers
 #include "resource_utils/defines/ResourceDefines.h"
@@ -15,13 +17,21 @@
 #include "utils/log/Log.h"
 
 // Own components headers
+#include "resource_builder/HashUtils.h"
+#include "resource_builder/LodBuilder.h"
 
 namespace {
-static std::hash<std::string> hashFunction;
-
 constexpr auto EXTERNAL_PATH_PREFIX = "external - ";
 constexpr auto EXTERNAL_PATH_PREFIX_SIZE = 11;
 constexpr auto MB_PRECISION_AFTER_DECIMAL = 3;
+constexpr double BYTES_PER_MB = 1024.0 * 1024.0;
+constexpr uint64_t BYTES_PER_KB = 1024;
+constexpr auto OUTPUT_LOCK_FILE_NAME = ".resource_builder.lock";
+
+// printable ASCII characters [32, 126]
+constexpr uint32_t ATLAS_ESTIMATE_GLYPHS_COUNT = 95;
+constexpr uint32_t ATLAS_GLYPH_PADDING = 1;
+constexpr uint32_t ATLAS_MAX_DIMENSION = 16384;
 
 #ifdef __linux__
 constexpr auto SLASH_IDENTIFIER = '/';
@@ -31,13 +41,37 @@ constexpr auto SLASH_IDENTIFIER = '\\';
 }
 
 ResourceParser::ResourceParser()
-    : _projectAbsFilePath("Not set") {
+    : _projectAbsFilePath("Not set"), _outputAbsFilePath("Not set") {
   resetInternals();
 }
 
-ErrorCode ResourceParser::init() {
+ErrorCode ResourceParser::init(const ResourceBuilderConfig &config) {
   _projectAbsFilePath = FileSystemUtils::getRootDirectory();
 
+  if (config.outputDir.empty()) {
+    _outputAbsFilePath = _projectAbsFilePath;
+  } else {
+    std::error_code errorCode;
+    _outputAbsFilePath =
+        std::filesystem::absolute(config.outputDir, errorCode).string();
+    if (errorCode) {
+      LOGERR("Error, invalid output directory: [%s], reason: %s",
+             config.outputDir.c_str(), errorCode.message().c_str());
+      return ErrorCode::FAILURE;
+    }
+
+    if (SLASH_IDENTIFIER != _outputAbsFilePath.back()) {
+      _outputAbsFilePath += SLASH_IDENTIFIER;
+    }
+  }
+
+  _textureBudget.init(config.textureBudgets);
+
+  if (ErrorCode::SUCCESS != _fileBuilder.init(config, _projectAbsFilePath)) {
+    LOGERR("Error in _fileBuilder.init()");
+    return ErrorCode::FAILURE;
+  }
+
   // Reserve enough memory for the whole parse process, no no unneeded
   // internal vector grow is invoked
   _fileData.reserve(200);
@@ -73,23 +107,40 @@ ErrorCode ResourceParser::parseResourceTree(const std::string &projectName) {
     }
   }
 
+  // the budgets are checked before the combined files are published
+  if (ErrorCode::SUCCESS == err) {
+    if (ErrorCode::SUCCESS != _textureBudget.checkProject()) {
+      LOGERR("Error, texture memory budget exceeded for project: %s",
+             projectName.c_str());
+      err = ErrorCode::FAILURE;
+    }
+  }
+
   if (ErrorCode::SUCCESS == err) {
-    _fileBuilder.finishCombinedDestFiles(_staticWidgetsCounter,
-        _dynamicWidgetsCounter, _fontsCounter, _musicsCounter, _chunksCounter,
-        _staticResFileTotalSize, _fontFileTotalSize, _soundFileTotalSize);
+    if (ErrorCode::SUCCESS != _fileBuilder.finishCombinedDestFiles(
+        _staticWidgetsCounter, _dynamicWidgetsCounter, _fontsCounter,
+        _musicsCounter, _chunksCounter, _staticResFileTotalSize,
+        _fontFileTotalSize, _soundFileTotalSize)) {
+      LOGERR("Error in _fileBuilder.finishCombinedDestFiles()");
+      err = ErrorCode::FAILURE;
+    }
+  } else {
+    // previously published combined files are left intact
+    _fileBuilder.closeCombinedStreams();
   }
 
   finishParseResourceTreeLogReport(err);
 
   // reset internal variables on both success and failure
   resetInternals();
+  _outputLock.unlock();
 
   return err;
 }
 
 ErrorCode ResourceParser::setupResourceTree() {
   // files above are located in the build directory
-  std::string projectAbsBuildFilePath = _projectAbsFilePath;
+  std::string projectAbsBuildFilePath = _outputAbsFilePath;
   projectAbsBuildFilePath.append(_projectFolder).append("/").append(
       ResourceFileHeader::getResourcesFolderName()).append("/").append(
       ResourceFileHeader::getAutoGeneratedFolderName());
@@ -105,6 +156,15 @@ ErrorCode ResourceParser::setupResourceTree() {
   }
 
   resourcesFolder += SLASH_IDENTIFIER;
+
+  // serialize concurrent resource_builder instances, which are writing
+  // into the same output directory
+  if (ErrorCode::SUCCESS !=
+      _outputLock.lock(resourcesFolder + OUTPUT_LOCK_FILE_NAME)) {
+    LOGERR("Error in _outputLock.lock() for '%s'", resourcesFolder.c_str());
+    return ErrorCode::FAILURE;
+  }
+
   const std::string resFile = resourcesFolder
       + ResourceFileHeader::getResourceBinName();
   const std::string fontFile = resourcesFolder
@@ -112,6 +172,17 @@ ErrorCode ResourceParser::setupResourceTree() {
   const std::string soundFile = resourcesFolder
       + ResourceFileHeader::getSoundBinName();
 
+  std::string indicesHeaderGuard = _projectFolder;
+  indicesHeaderGuard.append("_RESOURCE_INDICES_H_");
+  for (auto &letter : indicesHeaderGuard) {
+    if (isalpha(letter)) {
+      letter = static_cast<char>(std::toupper(letter));
+    } else if (!isalnum(letter)) {
+      letter = '_';
+    }
+  }
+  _fileBuilder.setCombinedHeaderGuards(indicesHeaderGuard);
+
   if (ErrorCode::SUCCESS != _fileBuilder.openCombinedStreams(resFile, fontFile,
           soundFile)) {
     LOGERR("Error in _fileBuilder.openCombinedStreams()");
@@ -131,6 +202,10 @@ ErrorCode ResourceParser::processAllFiles() {
     return ErrorCode::FAILURE;
   }
 
+  // the directory enumeration order is file system specific.
+  // Sort the files, so the produced outputs are identical on every machine
+  std::sort(files.begin(), files.end());
+
   for (const auto &fileName : files) {
     // Skip file if it's not resource file
     if (!isResourceFile(fileName)) {
@@ -211,6 +286,15 @@ ErrorCode ResourceParser::buildResourceFile() {
     }
   }
 
+  if (ErrorCode::SUCCESS == err) {
+    err = _textureBudget.checkResourceFile(_currAbsFilePath, _fileData);
+
+    if (ErrorCode::SUCCESS != err) {
+      LOGERR("Error, texture memory budget exceeded for %s",
+             _currAbsFilePath.c_str());
+    }
+  }
+
   if (ErrorCode::SUCCESS == err) {
     err = _fileBuilder.openDestStreams();
 
@@ -221,8 +305,22 @@ ErrorCode ResourceParser::buildResourceFile() {
 
   if (ErrorCode::SUCCESS == err) {
     // whole .rsrc file is parsed -> write its data
-    _fileBuilder.writeData(_fileData);
+    err = _fileBuilder.writeData(_fileData);
+
+    if (ErrorCode::SUCCESS != err) {
+      LOGERR("Error in writeData() for %s", _currDestFile.c_str());
+    }
+  }
+
+  if (ErrorCode::SUCCESS == err) {
+    err = _fileBuilder.publishDestStreams();
 
+    if (ErrorCode::SUCCESS != err) {
+      LOGERR("Error in publishDestStreams() for %s", _currDestFile.c_str());
+    }
+  }
+
+  if (ErrorCode::SUCCESS == err) {
     LOGG("[Done]");
   } else {
     LOG_ON_SAME_LINE("Parsing of %s ... ", _currAbsFilePath.c_str());
@@ -276,8 +374,10 @@ ErrorCode ResourceParser::buildResFileInternalData() {
     return ErrorCode::FAILURE;
   }
 
-  const std::string absResourceFolderPath = _currAbsFilePath.substr(0,
-      slashPos + 1);
+  // mirror the .rsrc file location inside the output directory
+  const std::string absResourceFolderPath = _outputAbsFilePath +
+      _currAbsFilePath.substr(_projectAbsFilePath.size(),
+          slashPos + 1 - _projectAbsFilePath.size());
 
   if (SLASH_IDENTIFIER != _projectFolder.back()) {
     ++relativePrjPathStartIdx;
@@ -304,6 +404,14 @@ ErrorCode ResourceParser::buildResFileInternalData() {
 
   _currDestFile = absResourceFolderPath;
   _currDestFile.append(ResourceFileHeader::getAutoGeneratedFolderName());
+  if (!FileSystemUtils::isDirectoryPresent(_currDestFile)) {
+    if (ErrorCode::SUCCESS !=
+        FileSystemUtils::createDirectoryRecursive(_currDestFile)) {
+      LOGERR("createDirectoryRecursive() failed for '%s'",
+          _currDestFile.c_str());
+      return ErrorCode::FAILURE;
+    }
+  }
   _currDestFile += SLASH_IDENTIFIER;
   _currDestFile.append(fileNameNoExtension).append("Resources");
 
@@ -325,7 +433,7 @@ ErrorCode ResourceParser::parseFileData() {
   int32_t eventCode = 0;
   int32_t parsedRowNumber = 0;
 
-  CombinedData combinedData;
+  BuilderCombinedData combinedData;
 
   // clear resources from previous parsed file
   _fileData.clear();
@@ -341,6 +449,46 @@ ErrorCode ResourceParser::parseFileData() {
       continue;
     } else if (lineData[0] == '#') { // it is comment line -> skip it
       continue;
+    } else if (_syntaxChecker.isGroupTag(lineData)) {
+      if (_fileData.empty()) {
+        LOGERR("Error, 'group' tag on line: %d does not follow an entry in %s",
+               parsedRowNumber, _currAbsFilePath.c_str());
+        return ErrorCode::FAILURE;
+      }
+
+      if (ErrorCode::SUCCESS != _syntaxChecker.extractRowData(lineData, rowData,
+              eventCode)) {
+        LOGERR("Error in extractRowData()");
+        return ErrorCode::FAILURE;
+      }
+
+      if (ErrorCode::SUCCESS != setLoadGroup(rowData, _fileData.back())) {
+        LOGERR("Error in setLoadGroup()");
+        return ErrorCode::FAILURE;
+      }
+
+      // the optional group tag does not take part in the field ordering
+      continue;
+    } else if (_syntaxChecker.isLodsTag(lineData)) {
+      if (_fileData.empty()) {
+        LOGERR("Error, 'lods' tag on line: %d does not follow an entry in %s",
+               parsedRowNumber, _currAbsFilePath.c_str());
+        return ErrorCode::FAILURE;
+      }
+
+      if (ErrorCode::SUCCESS != _syntaxChecker.extractRowData(lineData, rowData,
+              eventCode)) {
+        LOGERR("Error in extractRowData()");
+        return ErrorCode::FAILURE;
+      }
+
+      if (ErrorCode::SUCCESS != setLodScales(rowData, _fileData.back())) {
+        LOGERR("Error in setLodScales()");
+        return ErrorCode::FAILURE;
+      }
+
+      // the optional lods tag does not take part in the field ordering
+      continue;
     } else if (_syntaxChecker.hasValidTag(lineData)) {
       if (ErrorCode::SUCCESS != _syntaxChecker.extractRowData(lineData, rowData,
               eventCode)) {
@@ -362,15 +510,18 @@ ErrorCode ResourceParser::parseFileData() {
     _syntaxChecker.updateOrder();
 
     if (_syntaxChecker.isChunkReady()) {
+      // fonts and sounds are accounted in their own containers
+      const bool isWidget = ("font" != combinedData.type) &&
+                            ("sound" != combinedData.type);
+
       // accumulate only TextureLoadType::ON_INIT widgets!
-      if (_fileParser.isGraphicalFile() &&
-          (ResourceDefines::TextureLoadType::ON_INIT
+      if (isWidget && (ResourceDefines::TextureLoadType::ON_INIT
           == combinedData.textureLoadType)) {
         ++_staticWidgetsCounter;
-        _staticResFileTotalSize += combinedData.header.fileSize;
-      } else {
+        _staticResFileTotalSize += combinedData.fileSize;
+      } else if (isWidget) {
         ++_dynamicWidgetsCounter;
-        _dynamicResFileTotalSize += combinedData.header.fileSize;
+        _dynamicResFileTotalSize += combinedData.fileSize;
       }
 
       _fileData.emplace_back(combinedData);
@@ -391,7 +542,7 @@ ErrorCode ResourceParser::parseFileData() {
 
 ErrorCode ResourceParser::setSingleRowData(const std::string &rowData,
                                            const int32_t eventCode,
-                                           CombinedData &outData) {
+                                           BuilderCombinedData &outData) {
   switch (eventCode) {
   case ResourceDefines::Field::TAG:
     // get rid of the "[ ]" brackets
@@ -441,7 +592,7 @@ ErrorCode ResourceParser::setSingleRowData(const std::string &rowData,
 }
 
 ErrorCode ResourceParser::fillPath(const std::string &relativeFilePath,
-                                   CombinedData &outData) {
+                                   BuilderCombinedData &outData) {
 #ifdef __linux__
   const std::string& path = relativeFilePath;
 #else //windows
@@ -472,7 +623,10 @@ ErrorCode ResourceParser::fillPath(const std::string &relativeFilePath,
     return ErrorCode::FAILURE;
   }
 
-  outData.header.fileSize = _fileParser.getFileSizeInKiloBytes();
+  outData.fileSize = _fileParser.getFileSize();
+  // the legacy kBytes size is kept for the consumers of CombinedData
+  outData.header.fileSize = static_cast<int32_t>(std::min<uint64_t>(
+      outData.fileSize / BYTES_PER_KB, static_cast<uint64_t>(INT32_MAX)));
 
   if (_fileParser.isSupportedExtension()) {
     //TODO Zhivko Petrov: change the next line with .getAbsoluteFilePath() to
@@ -480,6 +634,14 @@ ErrorCode ResourceParser::fillPath(const std::string &relativeFilePath,
     //                    collisions and lose the possibility for
     //                    nested .rsrc files within a single project
     outData.header.path = _fileParser.getRelativeFilePath();
+    outData.absoluteFilePath = _fileParser.getAbsoluteFilePath();
+
+    // lets the runtime validate it's caches without reading the asset
+    if (ErrorCode::SUCCESS !=
+        _fileParser.readContentDigest(outData.contentDigest)) {
+      LOGERR("Error in _fileParser.readContentDigest()");
+      return ErrorCode::FAILURE;
+    }
 
     //file is a duplicate, this indicate error (probably copy/paste error)
     if (_uniqueFiles.find(outData.header.path) != _uniqueFiles.end()) {
@@ -492,18 +654,23 @@ ErrorCode ResourceParser::fillPath(const std::string &relativeFilePath,
     _uniqueFiles.insert(outData.header.path);
 
     // calculate hash value from resource string location
-    outData.header.hashValue = hashFunction(outData.header.path);
+    // NOTE: the hash value must be the same on every machine
+    outData.header.hashValue = HashUtils::hashResourcePath(outData.header.path);
 
     if (_fileParser.isGraphicalFile()) {
       _fileParser.getImageDimension(outData.imageRect.w, outData.imageRect.h);
+      _fileParser.getImageInfo(outData.imageInfo);
     }
+
+    _fileParser.getSoundInfo(outData.soundInfo);
+    _fileParser.getFontInfo(outData.fontInfo);
   }
 
   return ErrorCode::SUCCESS;
 }
 
 ErrorCode ResourceParser::fillDescription(const std::string &rowData,
-                                          CombinedData &outData) {
+                                          BuilderCombinedData &outData) {
   switch (_syntaxChecker.getFieldType()) {
   case ResourceDefines::FieldType::IMAGE:
     outData.spriteData.emplace_back(0, // x
@@ -573,8 +740,9 @@ ErrorCode ResourceParser::fillDescription(const std::string &rowData,
 
   case ResourceDefines::FieldType::FONT:
     outData.fontSize = StringUtils::safeStoi(rowData);
+    estimateFontAtlasSize(outData);
     ++_fontsCounter;
-    _fontFileTotalSize += outData.header.fileSize;
+    _fontFileTotalSize += outData.fileSize;
     break;
 
   case ResourceDefines::FieldType::SOUND: {
@@ -606,7 +774,7 @@ ErrorCode ResourceParser::fillDescription(const std::string &rowData,
     if ("low" == soundLevelType || "medium" == soundLevelType
         || "high" == soundLevelType || "very_high" == soundLevelType) {
       outData.soundLevel = soundLevelType;
-      _soundFileTotalSize += outData.header.fileSize;
+      _soundFileTotalSize += outData.fileSize;
     } else {
       LOGERR("Error wrong description for .rsrc file: %s, with "
              "tag: %s. Second argument 'sound level' must be "
@@ -627,7 +795,7 @@ ErrorCode ResourceParser::fillDescription(const std::string &rowData,
 }
 
 ErrorCode ResourceParser::setImagePosition(const std::string &rowData,
-                                           CombinedData &outData) {
+                                           BuilderCombinedData &outData) {
   std::vector<int32_t> data;
   constexpr uint32_t DATA_SIZE = 2;
 
@@ -645,7 +813,7 @@ ErrorCode ResourceParser::setImagePosition(const std::string &rowData,
 }
 
 ErrorCode ResourceParser::setTextureLoadType(const std::string &rowData,
-                                             CombinedData &outData) {
+                                             BuilderCombinedData &outData) {
   if ("on_init" == rowData) {
     outData.textureLoadType = ResourceDefines::TextureLoadType::ON_INIT;
   } else if ("on_demand" == rowData) {
@@ -660,6 +828,102 @@ ErrorCode ResourceParser::setTextureLoadType(const std::string &rowData,
   return ErrorCode::SUCCESS;
 }
 
+ErrorCode ResourceParser::setLoadGroup(const std::string &rowData,
+                                       BuilderCombinedData &outData) {
+  if (!outData.group.empty()) {
+    LOGERR("Error wrong description for .rsrc file: %s, with tag: %s. "
+           "Multiple 'group' tags provided", _currAbsFilePath.c_str(),
+           outData.tagName.c_str());
+    return ErrorCode::FAILURE;
+  }
+
+  for (const char letter : rowData) {
+    if (!isalnum(static_cast<unsigned char>(letter)) && ('_' != letter) &&
+        ('-' != letter)) {
+      LOGERR("Error wrong description for .rsrc file: %s, with tag: %s. "
+             "Group name: [%s] may only contain [a-zA-Z0-9_-] characters",
+             _currAbsFilePath.c_str(), outData.tagName.c_str(),
+             rowData.c_str());
+      return ErrorCode::FAILURE;
+    }
+  }
+
+  outData.group = rowData;
+
+  return ErrorCode::SUCCESS;
+}
+
+ErrorCode ResourceParser::setLodScales(const std::string &rowData,
+                                       BuilderCombinedData &outData) {
+  if (("font" == outData.type) || ("sound" == outData.type)) {
+    LOGERR("Error wrong description for .rsrc file: %s, with tag: %s. "
+           "'lods' tag is applicable only to images and sprites",
+           _currAbsFilePath.c_str(), outData.tagName.c_str());
+    return ErrorCode::FAILURE;
+  }
+
+  if (!outData.lodScales.empty()) {
+    LOGERR("Error wrong description for .rsrc file: %s, with tag: %s. "
+           "Multiple 'lods' tags provided", _currAbsFilePath.c_str(),
+           outData.tagName.c_str());
+    return ErrorCode::FAILURE;
+  }
+
+  if (!LodBuilder::parseScales(rowData, outData.lodScales)) {
+    LOGERR("Error wrong description for .rsrc file: %s, with tag: %s. "
+           "Scales: [%s] must be comma separated numbers in the (0, 1] "
+           "range (e.g. 1,0.5,0.25)", _currAbsFilePath.c_str(),
+           outData.tagName.c_str(), rowData.c_str());
+    return ErrorCode::FAILURE;
+  }
+
+  return ErrorCode::SUCCESS;
+}
+
+void ResourceParser::estimateFontAtlasSize(
+    BuilderCombinedData &outData) const {
+  FontInfo &info = outData.fontInfo;
+  if ((0 == info.unitsPerEm) || (0 >= outData.fontSize)) {
+    return;
+  }
+
+  // the font size is the em size in pixels
+  const double scale = static_cast<double>(outData.fontSize) /
+                       static_cast<double>(info.unitsPerEm);
+  const uint32_t glyphWidth = (0 != info.avgCharWidth) ?
+      info.avgCharWidth : info.advanceWidthMax;
+  const uint32_t cellWidth = static_cast<uint32_t>(
+      std::ceil(glyphWidth * scale)) + ATLAS_GLYPH_PADDING;
+  const uint32_t cellHeight = static_cast<uint32_t>(
+      std::ceil((info.ascent - info.descent) * scale)) + ATLAS_GLYPH_PADDING;
+  const uint32_t glyphsCount =
+      std::min(info.glyphCount, ATLAS_ESTIMATE_GLYPHS_COUNT);
+
+  // smallest power of two atlas, where all the glyph cells fit
+  uint32_t width = 1;
+  uint32_t height = 1;
+  while ((width <= ATLAS_MAX_DIMENSION) && (height <= ATLAS_MAX_DIMENSION)) {
+    const uint32_t columns = width / cellWidth;
+    if ((0 != columns) &&
+        (((glyphsCount + columns - 1) / columns) * cellHeight <= height)) {
+      info.atlasWidth = width;
+      info.atlasHeight = height;
+      return;
+    }
+
+    // grow the shorter side
+    if (width <= height) {
+      width *= 2;
+    } else {
+      height *= 2;
+    }
+  }
+
+  LOGR("Warning, glyph atlas for font: %s with size: %d does not fit in "
+       "%ux%u", outData.header.path.c_str(), outData.fontSize,
+       ATLAS_MAX_DIMENSION, ATLAS_MAX_DIMENSION);
+}
+
 void ResourceParser::resetInternals() {
   _startDir = "Not set";
   _currAbsFilePath = "Not set";
@@ -677,6 +941,7 @@ void ResourceParser::resetInternals() {
   _soundFileTotalSize = 0;
 
   _syntaxChecker.reset();
+  _textureBudget.reset();
   _fileData.clear();
 }
 
@@ -684,14 +949,14 @@ void ResourceParser::finishParseResourceTreeLogReport(
     const ErrorCode errorCode) {
   if (ErrorCode::SUCCESS == errorCode) {
     constexpr int32_t CONTAINERS_SIZE = 4;
-    const int32_t ITEMS_SIZE[CONTAINERS_SIZE] { _staticResFileTotalSize,
+    const uint64_t ITEMS_SIZE[CONTAINERS_SIZE] { _staticResFileTotalSize,
         _dynamicResFileTotalSize, _fontFileTotalSize, _soundFileTotalSize };
 
     std::string itemsSizeStr[CONTAINERS_SIZE];
 
     for (int32_t i = 0; i < CONTAINERS_SIZE; ++i) {
       itemsSizeStr[i] = std::to_string(
-          static_cast<double>(ITEMS_SIZE[i]) / 1024);
+          static_cast<double>(ITEMS_SIZE[i]) / BYTES_PER_MB);
       const size_t DOT_POS = itemsSizeStr[i].find('.');
 
       itemsSizeStr[i] = (itemsSizeStr[i].substr(0,
@@ -716,6 +981,12 @@ void ResourceParser::finishParseResourceTreeLogReport(
         ResourceFileHeader::getSoundBinName().c_str(),
         (_musicsCounter + _chunksCounter), itemsSizeStr[3].c_str());
     LOGG("[Done]");
+    LOG_ON_SAME_LINE("Decoded texture memory ... (static: %.3f MB and "
+        "dynamic: %.3f MB) ",
+        static_cast<double>(_textureBudget.getOnInitSize()) / BYTES_PER_MB,
+        static_cast<double>(_textureBudget.getOnDemandSize()) / BYTES_PER_MB);
+    LOGG("[Done]");
+    _textureBudget.logReport();
   } else {
     LOG_ON_SAME_LINE("\nRecursive search on %s ... ", _startDir.c_str());
     LOGR("[Failed]");
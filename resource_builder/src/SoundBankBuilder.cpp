@@ -0,0 +1,111 @@
+// Corresponding header
+#include "resource_builder/SoundBankBuilder.h"
+
+// System headers
+#include <cinttypes>
+#include <filesystem>
+#include <fstream>
+
+// Other libraries headers
+#include "utils/debug/StrError.h"
+#include "utils/log/Log.h"
+
+// Own components headers
+#include "resource_builder/BuilderStructs.h"
+
+namespace {
+constexpr auto READ_CHUNK_SIZE = 64 * 1024;
+}
+
+ErrorCode SoundBankBuilder::openBankStream(const std::string& fileName) {
+  _slots.clear();
+  _bankSize = 0;
+
+  if (ErrorCode::SUCCESS != _bankStream.begin(fileName)) {
+    LOGERR("Error in _bankStream.begin()");
+    return ErrorCode::FAILURE;
+  }
+
+  return ErrorCode::SUCCESS;
+}
+
+ErrorCode SoundBankBuilder::writeData(
+    const std::vector<BuilderCombinedData>& data) {
+  std::vector<char> buffer(READ_CHUNK_SIZE);
+
+  for (const auto& entry : data) {
+    if (("sound" != entry.type) || ("chunk" != entry.soundType)) {
+      continue;
+    }
+
+    std::ifstream soundStream(entry.absoluteFilePath.c_str(),
+                              std::ifstream::in | std::ifstream::binary);
+    if (!soundStream) {
+      LOGERR("Error, could not open ifstream for fileName: %s, reason: %s",
+             entry.absoluteFilePath.c_str(), strError().c_str());
+      return ErrorCode::FAILURE;
+    }
+
+    // pad the previous payload up to the alignment boundary
+    const uint64_t padding = (SOUND_BANK_ALIGNMENT -
+        (_bankSize % SOUND_BANK_ALIGNMENT)) % SOUND_BANK_ALIGNMENT;
+    for (uint64_t i = 0; i < padding; ++i) {
+      _bankStream.put('\0');
+    }
+    _bankSize += padding;
+
+    SoundBankSlot slot;
+    slot.offset = _bankSize;
+
+    while (soundStream) {
+      soundStream.read(buffer.data(), READ_CHUNK_SIZE);
+      const std::streamsize bytesRead = soundStream.gcount();
+      _bankStream.write(buffer.data(), bytesRead);
+      slot.size += static_cast<uint64_t>(bytesRead);
+    }
+
+    if (!_bankStream) {
+      LOGERR("Error, could not write %s into the sound bank",
+             entry.absoluteFilePath.c_str());
+      return ErrorCode::FAILURE;
+    }
+
+    _bankSize += slot.size;
+    _slots[entry.header.hashValue] = slot;
+  }
+
+  return ErrorCode::SUCCESS;
+}
+
+bool SoundBankBuilder::getSlot(const uint64_t hashValue,
+                               SoundBankSlot& outSlot) const {
+  const auto it = _slots.find(hashValue);
+  if (_slots.end() == it) {
+    return false;
+  }
+
+  outSlot = it->second;
+  return true;
+}
+
+ErrorCode SoundBankBuilder::publishBankStream(const bool syncToDisk) {
+  if (ErrorCode::SUCCESS != _bankStream.publish(syncToDisk)) {
+    LOGERR("Error, could not publish: %s",
+           _bankStream.getFileName().c_str());
+    return ErrorCode::FAILURE;
+  }
+
+  const std::string fileName =
+      std::filesystem::path(_bankStream.getFileName()).filename().string();
+  LOG_ON_SAME_LINE("%s generation ... (%zu chunks with size: %" PRIu64
+                   " bytes) ", fileName.c_str(), _slots.size(), _bankSize);
+  LOGG("[Done]");
+
+  return ErrorCode::SUCCESS;
+}
+
+void SoundBankBuilder::closeBankStream() {
+  _bankStream.discard();
+  _slots.clear();
+  _bankSize = 0;
+}
@@ -0,0 +1,56 @@
+// Corresponding header
+#include "resource_builder/SpriteGrid.h"
+
+// System headers
+
+// Other libraries headers
+
+// Own components headers
+
+bool SpriteGrid::fromFrames(const std::vector<Rectangle>& frames,
+                            SpriteGrid& outGrid) {
+  if (frames.empty()) {
+    return false;
+  }
+
+  const Rectangle& first = frames.front();
+  const uint32_t framesCount = static_cast<uint32_t>(frames.size());
+
+  // the first row ends with the first frame, placed on another y position
+  uint32_t columns = 1;
+  while ((columns < framesCount) && (first.y == frames[columns].y)) {
+    ++columns;
+  }
+
+  SpriteGrid grid;
+  grid.originX = first.x;
+  grid.originY = first.y;
+  grid.frameWidth = first.w;
+  grid.frameHeight = first.h;
+  grid.count = framesCount;
+  grid.columns = columns;
+
+  if (1 < columns) {
+    grid.spacingX = frames[1].x - first.x - first.w;
+  }
+
+  if (columns < framesCount) {
+    grid.spacingY = frames[columns].y - first.y - first.h;
+  }
+
+  if ((0 > grid.spacingX) || (0 > grid.spacingY)) {
+    return false;
+  }
+
+  for (uint32_t i = 0; i < framesCount; ++i) {
+    const Rectangle expected = grid.getFrame(i);
+    const Rectangle& actual = frames[i];
+    if ((expected.x != actual.x) || (expected.y != actual.y) ||
+        (expected.w != actual.w) || (expected.h != actual.h)) {
+      return false;
+    }
+  }
+
+  outGrid = grid;
+  return true;
+}
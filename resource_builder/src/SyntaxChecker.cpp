@@ -10,6 +10,16 @@
 
 // Own components headers
 
+namespace {
+/* Compares the whole key before the '=' sign, so the keys, which only
+ * start with the provided one (e.g. 'groupx=') are not matched */
+bool hasFieldKey(const std::string& line, const std::string& key) {
+  const size_t separatorPos = line.find('=');
+  return (std::string::npos != separatorPos) &&
+         (0 == line.compare(0, separatorPos, key));
+}
+}
+
 SyntaxChecker::SyntaxChecker()
     : _TAG_STR("tag"),
       _PATH_STR("path"),
@@ -17,6 +27,8 @@ SyntaxChecker::SyntaxChecker()
       _DESCR_STR("description"),
       _POS_STR("position"),
       _LOAD_STR("load"),
+      _GROUP_STR("group"),
+      _LODS_STR("lods"),
       _TAG_STR_SIZE(_TAG_STR.size()),
       _PATH_STR_SIZE(_PATH_STR.size()),
       _TYPE_STR_SIZE(_TYPE_STR.size()),
@@ -41,6 +53,24 @@ void SyntaxChecker::updateOrder() {
   }
 }
 
+bool SyntaxChecker::isGroupTag(const std::string& line) const {
+  // the group tag may only follow a fully completed entry
+  if (ResourceDefines::Field::TAG != _currField) {
+    return false;
+  }
+
+  return hasFieldKey(line, _GROUP_STR);
+}
+
+bool SyntaxChecker::isLodsTag(const std::string& line) const {
+  // the lods tag may only follow a fully completed entry
+  if (ResourceDefines::Field::TAG != _currField) {
+    return false;
+  }
+
+  return hasFieldKey(line, _LODS_STR);
+}
+
 bool SyntaxChecker::hasValidTag(const std::string& line) {
   bool success = true;
 
@@ -0,0 +1,179 @@
+// Corresponding header
+#include "resource_builder/TextureBudget.h"
+
+// System headers
+#include <cctype>
+#include <cinttypes>
+#include <cstdlib>
+#include <utility>
+
+// Other libraries headers
+#include "resource_utils/defines/ResourceDefines.h"
+#include "utils/log/Log.h"
+
+// Own components headers
+#include "resource_builder/BuilderStructs.h"
+
+namespace {
+constexpr double BYTES_PER_MB = 1024.0 * 1024.0;
+constexpr int32_t DECIMAL_BASE = 10;
+
+double toMegaBytes(const uint64_t bytes) {
+  return static_cast<double>(bytes) / BYTES_PER_MB;
+}
+}
+
+TextureBudget::TextureBudget() : _onInitSize(0), _onDemandSize(0) {}
+
+void TextureBudget::init(const TextureBudgets& budgets) {
+  _budgets = budgets;
+}
+
+ErrorCode TextureBudget::checkResourceFile(
+    const std::string& fileName,
+    const std::vector<BuilderCombinedData>& data) {
+  auto err = ErrorCode::SUCCESS;
+  ResourceFileSize resourceFileSize;
+  resourceFileSize.fileName = fileName;
+
+  for (const auto& entry : data) {
+    const uint64_t size = getDecodedSize(entry);
+
+    if (ResourceDefines::TextureLoadType::ON_INIT == entry.textureLoadType) {
+      resourceFileSize.onInitSize += size;
+    } else {
+      resourceFileSize.onDemandSize += size;
+    }
+
+    if ((0 != _budgets.entry) && (_budgets.entry < size) &&
+        (ErrorCode::SUCCESS != reportExceeded("entry", entry.header.path,
+                                              size, _budgets.entry))) {
+      err = ErrorCode::FAILURE;
+    }
+  }
+
+  _onInitSize += resourceFileSize.onInitSize;
+  _onDemandSize += resourceFileSize.onDemandSize;
+  const uint64_t fileSize =
+      resourceFileSize.onInitSize + resourceFileSize.onDemandSize;
+  _resourceFileSizes.push_back(std::move(resourceFileSize));
+
+  if ((0 != _budgets.resourceFile) && (_budgets.resourceFile < fileSize) &&
+      (ErrorCode::SUCCESS != reportExceeded(".rsrc file", fileName,
+                                            fileSize,
+                                            _budgets.resourceFile))) {
+    err = ErrorCode::FAILURE;
+  }
+
+  return err;
+}
+
+ErrorCode TextureBudget::checkProject() const {
+  auto err = ErrorCode::SUCCESS;
+
+  if ((0 != _budgets.onInit) && (_budgets.onInit < _onInitSize) &&
+      (ErrorCode::SUCCESS != reportExceeded("load type", "on_init",
+                                            _onInitSize, _budgets.onInit))) {
+    err = ErrorCode::FAILURE;
+  }
+
+  if ((0 != _budgets.onDemand) && (_budgets.onDemand < _onDemandSize) &&
+      (ErrorCode::SUCCESS != reportExceeded("load type", "on_demand",
+                                            _onDemandSize,
+                                            _budgets.onDemand))) {
+    err = ErrorCode::FAILURE;
+  }
+
+  return err;
+}
+
+void TextureBudget::logReport() const {
+  for (const auto& resourceFileSize : _resourceFileSizes) {
+    LOGR("  %s - static: %.3f MB and dynamic: %.3f MB",
+         resourceFileSize.fileName.c_str(),
+         toMegaBytes(resourceFileSize.onInitSize),
+         toMegaBytes(resourceFileSize.onDemandSize));
+  }
+}
+
+void TextureBudget::reset() {
+  _onInitSize = 0;
+  _onDemandSize = 0;
+  _resourceFileSizes.clear();
+}
+
+uint64_t TextureBudget::getDecodedSize(const BuilderCombinedData& entry) {
+  if (("font" == entry.type) || ("sound" == entry.type) ||
+      (0 >= entry.imageRect.w) || (0 >= entry.imageRect.h)) {
+    return 0;
+  }
+
+  // GPU textures stay compressed in the video memory
+  if ((TextureContainer::NONE != entry.imageInfo.container) &&
+      (0 != entry.imageInfo.gpuSize)) {
+    return entry.imageInfo.gpuSize;
+  }
+
+  return static_cast<uint64_t>(entry.imageRect.w) *
+         static_cast<uint64_t>(entry.imageRect.h) * DECODED_BYTES_PER_PIXEL;
+}
+
+bool TextureBudget::parseSize(const std::string& text, uint64_t& outSize) {
+  if (text.empty() || !isdigit(static_cast<unsigned char>(text.front()))) {
+    return false;
+  }
+
+  char* end = nullptr;
+  const unsigned long long value = strtoull(text.c_str(), &end, DECIMAL_BASE);
+
+  uint32_t shift = 0;
+  switch (*end) {
+    case '\0':
+      break;
+    case 'K':
+    case 'k':
+      shift = 10;
+      break;
+    case 'M':
+    case 'm':
+      shift = 20;
+      break;
+    case 'G':
+    case 'g':
+      shift = 30;
+      break;
+    default:
+      return false;
+  }
+
+  if (('\0' != *end) && ('\0' != *(end + 1))) {
+    return false;
+  }
+
+  // reject values, which do not fit after the shift
+  if ((value << shift) >> shift != value) {
+    return false;
+  }
+
+  outSize = static_cast<uint64_t>(value) << shift;
+  return true;
+}
+
+ErrorCode TextureBudget::reportExceeded(const char* scope,
+                                        const std::string& name,
+                                        const uint64_t size,
+                                        const uint64_t budget) const {
+  if (BudgetAction::FAIL == _budgets.action) {
+    LOGERR("Error, decoded texture memory of %s: %s is %.3f MB (%" PRIu64
+           " bytes), which exceeds the budget of %.3f MB (%" PRIu64
+           " bytes)", scope, name.c_str(), toMegaBytes(size), size,
+           toMegaBytes(budget), budget);
+    return ErrorCode::FAILURE;
+  }
+
+  LOGR("Warning, decoded texture memory of %s: %s is %.3f MB (%" PRIu64
+       " bytes), which exceeds the budget of %.3f MB (%" PRIu64 " bytes)",
+       scope, name.c_str(), toMegaBytes(size), size, toMegaBytes(budget),
+       budget);
+  return ErrorCode::SUCCESS;
+}
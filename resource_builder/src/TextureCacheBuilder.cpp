@@ -0,0 +1,224 @@
+// Corresponding header
+#include "resource_builder/TextureCacheBuilder.h"
+
+// System headers
+#include <cinttypes>
+#include <filesystem>
+#include <fstream>
+#include <iomanip>
+#include <iterator>
+#include <sstream>
+#include <system_error>
+
+// Other libraries headers
+#include "utils/debug/StrError.h"
+#include "utils/log/Log.h"
+
+// Own components headers
+#include "resource_builder/AtomicFileStream.h"
+#include "resource_builder/BuilderStructs.h"
+#include "resource_builder/HashUtils.h"
+#include "resource_builder/PngCodec.h"
+
+namespace {
+constexpr auto MAX_UINT64_T_HEX_LENGTH = 16;
+constexpr auto TEXTURES_FOLDER_NAME = "textures";
+constexpr auto BLOB_FILE_EXTENSION = ".rgba";
+constexpr char BLOB_MAGIC[] = { 'R', 'G', 'B', 'A' };
+constexpr uint32_t BLOB_VERSION = 1;
+constexpr uint32_t BLOB_FLAG_PREMULTIPLIED = 0x1;
+constexpr size_t BLOB_HEADER_SIZE = 32;
+
+void appendLittleEndian(std::vector<uint8_t>& out, const uint64_t value,
+                        const size_t bytes) {
+  for (size_t i = 0; i < bytes; ++i) {
+    out.push_back(static_cast<uint8_t>(value >> (8 * i)));
+  }
+}
+
+void premultiplyAlpha(RgbaImage& image) {
+  for (size_t i = 0; i < image.pixels.size(); i += RgbaImage::CHANNELS) {
+    const uint32_t alpha = image.pixels[i + 3];
+    for (size_t channel = 0; channel < 3; ++channel) {
+      // rounded division by 255
+      image.pixels[i + channel] = static_cast<uint8_t>(
+          ((image.pixels[i + channel] * alpha) + 127) / 255);
+    }
+  }
+}
+}
+
+TextureCacheBuilder::TextureCacheBuilder() : _mode(TextureCacheMode::NONE) {}
+
+void TextureCacheBuilder::init(const TextureCacheMode mode) {
+  _mode = mode;
+}
+
+ErrorCode TextureCacheBuilder::writeData(
+    const std::string& destDir, const std::vector<BuilderCombinedData>& data,
+    const bool syncToDisk) {
+  reset();
+
+  const std::filesystem::path texturesDir =
+      std::filesystem::path(destDir) / TEXTURES_FOLDER_NAME;
+  std::error_code errorCode;
+  std::ostringstream nameStream;
+  uint64_t decodedCount = 0;
+  uint64_t reusedCount = 0;
+
+  for (const auto& entry : data) {
+    // GPU compressed textures are uploaded without decoding
+    if (("font" == entry.type) || ("sound" == entry.type) ||
+        (TextureContainer::NONE != entry.imageInfo.container) ||
+        (_blobNames.end() != _blobNames.find(entry.header.hashValue))) {
+      continue;
+    }
+
+    if (!entry.imageInfo.isPng) {
+      LOGR("Warning, image: %s is not a PNG. It will be decoded at runtime",
+           entry.header.path.c_str());
+      continue;
+    }
+
+    // the blob version and the mode are part of the key,
+    // since they change the blob content
+    const uint64_t keySeed = (static_cast<uint64_t>(BLOB_VERSION) << 8) |
+                             static_cast<uint64_t>(_mode);
+    const uint64_t contentHash =
+        HashUtils::hashDigest(entry.contentDigest, keySeed);
+    nameStream.str("");
+    nameStream << "0x" << std::hex << std::uppercase
+               << std::setw(MAX_UINT64_T_HEX_LENGTH) << std::setfill('0')
+               << contentHash << BLOB_FILE_EXTENSION;
+    const std::string blobName =
+        (std::filesystem::path(TEXTURES_FOLDER_NAME) / nameStream.str())
+            .generic_string();
+    const std::filesystem::path blobPath = texturesDir / nameStream.str();
+
+    _blobNames.emplace(entry.header.hashValue, blobName);
+    if (!_usedBlobNames.insert(blobName).second) {
+      continue;
+    }
+
+    // blobs are content addressed - an existing blob is always up to date
+    if (std::filesystem::is_regular_file(blobPath, errorCode)) {
+      ++reusedCount;
+      continue;
+    }
+
+    // the image is read only when it's blob has to be produced
+    std::ifstream imageStream(entry.absoluteFilePath.c_str(),
+                              std::ifstream::in | std::ifstream::binary);
+    if (!imageStream) {
+      LOGERR("Error, could not open ifstream for fileName: %s, reason: %s",
+             entry.absoluteFilePath.c_str(), strError().c_str());
+      return ErrorCode::FAILURE;
+    }
+    const std::vector<uint8_t> fileData(
+        (std::istreambuf_iterator<char>(imageStream)),
+        std::istreambuf_iterator<char>());
+
+    RgbaImage image;
+    if (ErrorCode::SUCCESS != PngCodec::decode(fileData, image)) {
+      LOGERR("Error, could not decode image: %s",
+             entry.absoluteFilePath.c_str());
+      return ErrorCode::FAILURE;
+    }
+
+    std::filesystem::create_directories(texturesDir, errorCode);
+    if (errorCode) {
+      LOGERR("Error, could not create directory: %s, reason: %s",
+             texturesDir.string().c_str(), errorCode.message().c_str());
+      return ErrorCode::FAILURE;
+    }
+
+    if (ErrorCode::SUCCESS !=
+        writeBlob(image, blobPath.string(), syncToDisk)) {
+      LOGERR("Error, writeBlob() failed for image: %s",
+             entry.header.path.c_str());
+      return ErrorCode::FAILURE;
+    }
+    ++decodedCount;
+  }
+
+  LOG_ON_SAME_LINE("Texture cache generation ... (%" PRIu64 " decoded, %"
+                   PRIu64 " reused) ", decodedCount, reusedCount);
+  LOGG("[Done]");
+
+  return ErrorCode::SUCCESS;
+}
+
+bool TextureCacheBuilder::getBlobName(const uint64_t hashValue,
+                                      std::string& outName) const {
+  const auto it = _blobNames.find(hashValue);
+  if (_blobNames.end() == it) {
+    return false;
+  }
+
+  outName = it->second;
+  return true;
+}
+
+void TextureCacheBuilder::removeStaleBlobs(const std::string& destDir) const {
+  const std::filesystem::path texturesDir =
+      std::filesystem::path(destDir) / TEXTURES_FOLDER_NAME;
+
+  std::error_code errorCode;
+  if (!std::filesystem::is_directory(texturesDir, errorCode)) {
+    return;
+  }
+
+  for (const auto& dirEntry :
+       std::filesystem::directory_iterator(texturesDir, errorCode)) {
+    const std::filesystem::path& path = dirEntry.path();
+    const std::string name =
+        (std::filesystem::path(TEXTURES_FOLDER_NAME) / path.filename())
+            .generic_string();
+    if ((BLOB_FILE_EXTENSION == path.extension().string()) &&
+        (_usedBlobNames.end() == _usedBlobNames.find(name))) {
+      std::filesystem::remove(path, errorCode);
+    }
+  }
+}
+
+void TextureCacheBuilder::reset() {
+  _blobNames.clear();
+  _usedBlobNames.clear();
+}
+
+ErrorCode TextureCacheBuilder::writeBlob(RgbaImage& image,
+                                         const std::string& fileName,
+                                         const bool syncToDisk) const {
+  uint32_t flags = 0;
+  if (TextureCacheMode::PREMULTIPLIED_ALPHA == _mode) {
+    premultiplyAlpha(image);
+    flags |= BLOB_FLAG_PREMULTIPLIED;
+  }
+
+  std::vector<uint8_t> header(std::begin(BLOB_MAGIC), std::end(BLOB_MAGIC));
+  appendLittleEndian(header, BLOB_VERSION, sizeof(uint32_t));
+  appendLittleEndian(header, image.width, sizeof(uint32_t));
+  appendLittleEndian(header, image.height, sizeof(uint32_t));
+  appendLittleEndian(header, flags, sizeof(uint32_t));
+  appendLittleEndian(header, 0, sizeof(uint32_t));
+  appendLittleEndian(header, image.pixels.size(), sizeof(uint64_t));
+  header.resize(BLOB_HEADER_SIZE, 0);
+
+  AtomicFileStream blobStream;
+  if (ErrorCode::SUCCESS != blobStream.begin(fileName)) {
+    LOGERR("Error in blobStream.begin()");
+    return ErrorCode::FAILURE;
+  }
+
+  blobStream.write(reinterpret_cast<const char*>(header.data()),
+                   static_cast<std::streamsize>(header.size()));
+  blobStream.write(reinterpret_cast<const char*>(image.pixels.data()),
+                   static_cast<std::streamsize>(image.pixels.size()));
+
+  if (ErrorCode::SUCCESS != blobStream.publish(syncToDisk)) {
+    LOGERR("Error, could not publish: %s", fileName.c_str());
+    return ErrorCode::FAILURE;
+  }
+
+  return ErrorCode::SUCCESS;
+}
@@ -0,0 +1,771 @@
+// Corresponding header
+#include "resource_builder/TrueTypeFont.h"
+
+// System headers
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <fstream>
+#include <iterator>
+
+// Other libraries headers
+#include "utils/debug/StrError.h"
+#include "utils/log/Log.h"
+
+// Own components headers
+
+namespace {
+constexpr size_t SFNT_HEADER_SIZE = 12;
+constexpr size_t SFNT_TABLE_RECORD_SIZE = 16;
+constexpr size_t TTC_HEADER_SIZE = 16;
+constexpr size_t HEAD_TABLE_MIN_SIZE = 54;
+constexpr size_t HHEA_TABLE_MIN_SIZE = 36;
+constexpr size_t MAXP_TABLE_MIN_SIZE = 6;
+constexpr size_t CMAP_RECORD_SIZE = 8;
+constexpr size_t GLYPH_HEADER_SIZE = 10;
+
+constexpr uint8_t FLAG_ON_CURVE = 0x01;
+constexpr uint8_t FLAG_X_SHORT = 0x02;
+constexpr uint8_t FLAG_Y_SHORT = 0x04;
+constexpr uint8_t FLAG_REPEAT = 0x08;
+constexpr uint8_t FLAG_X_SAME_OR_POSITIVE = 0x10;
+constexpr uint8_t FLAG_Y_SAME_OR_POSITIVE = 0x20;
+
+constexpr uint16_t COMPOSITE_ARGS_ARE_WORDS = 0x0001;
+constexpr uint16_t COMPOSITE_ARGS_ARE_XY_VALUES = 0x0002;
+constexpr uint16_t COMPOSITE_HAVE_SCALE = 0x0008;
+constexpr uint16_t COMPOSITE_MORE_COMPONENTS = 0x0020;
+constexpr uint16_t COMPOSITE_HAVE_XY_SCALE = 0x0040;
+constexpr uint16_t COMPOSITE_HAVE_2X2 = 0x0080;
+constexpr uint32_t MAX_COMPOSITE_DEPTH = 8;
+
+constexpr float F2DOT14_SCALE = 1.f / 16384.f;
+constexpr uint32_t MAX_GLYPH_DIMENSION = 4096;
+
+// the allowed deviation of the flattened curves in 1/16 pixel units
+constexpr float CURVE_FLATTENING_TOLERANCE = 3.f;
+
+struct Point {
+  float x = 0.f;
+  float y = 0.f;
+};
+
+/** @brief used to accumulate the signed area coverage of a line into
+ *         the accumulation buffer. The buffer is later prefix summed
+ *         row by row, which produces the exact pixel coverage.
+ * */
+void accumulateLine(const Point& from, const Point& to, const uint32_t width,
+                    const uint32_t height, std::vector<float>& accumulation) {
+  if (from.y == to.y) {
+    return;
+  }
+
+  const bool isDownwards = from.y < to.y;
+  const float direction = isDownwards ? 1.f : -1.f;
+  const Point& p0 = isDownwards ? from : to;
+  const Point& p1 = isDownwards ? to : from;
+  const float dxdy = (p1.x - p0.x) / (p1.y - p0.y);
+
+  float x = p0.x;
+  if (0.f > p0.y) {
+    x -= p0.y * dxdy;
+  }
+
+  const uint32_t firstRow = static_cast<uint32_t>(std::max(0.f, p0.y));
+  const uint32_t lastRow = std::min(height,
+      static_cast<uint32_t>(std::max(0.f, std::ceil(p1.y))));
+  for (uint32_t row = firstRow; row < lastRow; ++row) {
+    const size_t rowStart = static_cast<size_t>(row) * width;
+    const float dy = std::min(static_cast<float>(row + 1), p1.y) -
+                     std::max(static_cast<float>(row), p0.y);
+    const float xNext = x + (dxdy * dy);
+    const float area = dy * direction;
+
+    const float left = std::clamp(std::min(x, xNext), 0.f,
+                                  static_cast<float>(width));
+    const float right = std::clamp(std::max(x, xNext), 0.f,
+                                   static_cast<float>(width));
+    const float leftFloor = std::floor(left);
+    const float rightCeil = std::ceil(right);
+    const size_t leftIdx = rowStart + static_cast<size_t>(leftFloor);
+    const size_t rightIdx = rowStart + static_cast<size_t>(rightCeil);
+
+    if (rightIdx <= leftIdx + 1) {
+      // the line stays within a single pixel column
+      const float middle = (0.5f * (left + right)) - leftFloor;
+      accumulation[leftIdx] += area - (area * middle);
+      accumulation[leftIdx + 1] += area * middle;
+    } else {
+      const float slope = 1.f / (right - left);
+      const float leftFraction = left - leftFloor;
+      const float leftArea =
+          0.5f * slope * (1.f - leftFraction) * (1.f - leftFraction);
+      const float rightFraction = right - rightCeil + 1.f;
+      const float rightArea = 0.5f * slope * rightFraction * rightFraction;
+
+      accumulation[leftIdx] += area * leftArea;
+      if (rightIdx == leftIdx + 2) {
+        accumulation[leftIdx + 1] += area * (1.f - leftArea - rightArea);
+      } else {
+        const float secondArea = slope * (1.5f - leftFraction);
+        accumulation[leftIdx + 1] += area * (secondArea - leftArea);
+        for (size_t idx = leftIdx + 2; idx < rightIdx - 1; ++idx) {
+          accumulation[idx] += area * slope;
+        }
+        const float lastArea = secondArea +
+            (static_cast<float>(rightIdx - leftIdx - 3) * slope);
+        accumulation[rightIdx - 1] += area * (1.f - lastArea - rightArea);
+      }
+      accumulation[rightIdx] += area * rightArea;
+    }
+
+    x = xNext;
+  }
+}
+
+void accumulateQuadratic(const Point& p0, const Point& p1, const Point& p2,
+                         const uint32_t width, const uint32_t height,
+                         std::vector<float>& accumulation) {
+  const float deviationX = p0.x - (2.f * p1.x) + p2.x;
+  const float deviationY = p0.y - (2.f * p1.y) + p2.y;
+  const float deviationSq = (deviationX * deviationX) +
+                            (deviationY * deviationY);
+  const uint32_t segments = 1 + static_cast<uint32_t>(
+      std::sqrt(std::sqrt(CURVE_FLATTENING_TOLERANCE * deviationSq)));
+
+  Point prev = p0;
+  for (uint32_t i = 1; i <= segments; ++i) {
+    const float t = static_cast<float>(i) / static_cast<float>(segments);
+    const float mt = 1.f - t;
+    const Point next { (mt * mt * p0.x) + (2.f * mt * t * p1.x) +
+                           (t * t * p2.x),
+                       (mt * mt * p0.y) + (2.f * mt * t * p1.y) +
+                           (t * t * p2.y) };
+    accumulateLine(prev, next, width, height, accumulation);
+    prev = next;
+  }
+}
+}
+
+TrueTypeFont::TrueTypeFont()
+    : _headOffset(0), _locaOffset(0), _locaSize(0), _glyfOffset(0),
+      _glyfSize(0), _hheaOffset(0), _hmtxOffset(0), _hmtxSize(0),
+      _maxpOffset(0), _cmapOffset(0), _cmapSize(0), _charMapOffset(0),
+      _charMapFormat(0), _unitsPerEm(0), _glyphCount(0),
+      _horizontalMetricsCount(0), _isLongLocaFormat(false) {}
+
+ErrorCode TrueTypeFont::load(const std::string& fileName) {
+  _fileName = fileName;
+
+  std::ifstream fontStream(fileName.c_str(),
+                           std::ifstream::in | std::ifstream::binary);
+  if (!fontStream) {
+    LOGERR("Error, could not open ifstream for fileName: %s, reason: %s",
+           fileName.c_str(), strError().c_str());
+    return ErrorCode::FAILURE;
+  }
+
+  _data.assign(std::istreambuf_iterator<char>(fontStream),
+               std::istreambuf_iterator<char>());
+
+  if (ErrorCode::SUCCESS != locateTables()) {
+    LOGERR("Error, locateTables() failed for font: %s", fileName.c_str());
+    return ErrorCode::FAILURE;
+  }
+
+  if (ErrorCode::SUCCESS != selectCharacterMap()) {
+    LOGERR("Error, selectCharacterMap() failed for font: %s",
+           fileName.c_str());
+    return ErrorCode::FAILURE;
+  }
+
+  return ErrorCode::SUCCESS;
+}
+
+float TrueTypeFont::getScale(const int32_t pixelSize) const {
+  return static_cast<float>(pixelSize) / static_cast<float>(_unitsPerEm);
+}
+
+uint32_t TrueTypeFont::findGlyphIndex(const uint32_t codepoint) const {
+  if (12 == _charMapFormat) {
+    const uint32_t groupsCount = readU32(_charMapOffset + 12);
+    for (uint32_t i = 0; i < groupsCount; ++i) {
+      const size_t group = _charMapOffset + 16 + (static_cast<size_t>(i) * 12);
+      const uint32_t startCode = readU32(group);
+      if (codepoint < startCode) {
+        break;
+      }
+      if (codepoint <= readU32(group + 4)) {
+        return readU32(group + 8) + (codepoint - startCode);
+      }
+    }
+    return 0;
+  }
+
+  // format 4 covers only the basic multilingual plane
+  if (0xFFFF < codepoint) {
+    return 0;
+  }
+
+  const size_t segmentsSize = readU16(_charMapOffset + 6);
+  const size_t endCodes = _charMapOffset + 14;
+  const size_t startCodes = endCodes + segmentsSize + 2;
+  const size_t idDeltas = startCodes + segmentsSize;
+  const size_t idRangeOffsets = idDeltas + segmentsSize;
+
+  for (size_t segment = 0; segment < segmentsSize; segment += 2) {
+    if (codepoint > readU16(endCodes + segment)) {
+      continue;
+    }
+
+    const uint16_t startCode = readU16(startCodes + segment);
+    if (codepoint < startCode) {
+      return 0;
+    }
+
+    const uint16_t idDelta = readU16(idDeltas + segment);
+    const uint16_t idRangeOffset = readU16(idRangeOffsets + segment);
+    if (0 == idRangeOffset) {
+      return (codepoint + idDelta) & 0xFFFFU;
+    }
+
+    const size_t glyphIdOffset = idRangeOffsets + segment + idRangeOffset +
+                                 (2 * (codepoint - startCode));
+    const uint16_t glyphIdx = readU16(glyphIdOffset);
+    return (0 == glyphIdx) ? 0 : ((glyphIdx + idDelta) & 0xFFFFU);
+  }
+
+  return 0;
+}
+
+ErrorCode TrueTypeFont::rasterizeGlyph(const uint32_t glyphIdx,
+                                       const float scale,
+                                       GlyphBitmap& outGlyph) const {
+  outGlyph = GlyphBitmap();
+
+  const uint32_t metricIdx =
+      std::min(glyphIdx, _horizontalMetricsCount - 1);
+  const uint16_t advanceWidth = readU16(_hmtxOffset + (4 * metricIdx));
+  outGlyph.advance =
+      static_cast<int32_t>(std::lround(static_cast<float>(advanceWidth) *
+                                       scale));
+
+  std::vector<Contour> contours;
+  if (ErrorCode::SUCCESS !=
+      appendGlyphContours(glyphIdx, Transform(), 0, contours)) {
+    LOGERR("Error, could not decode glyph: %u of font: %s", glyphIdx,
+           _fileName.c_str());
+    return ErrorCode::FAILURE;
+  }
+
+  float minX = 0.f;
+  float maxX = 0.f;
+  float minY = 0.f;
+  float maxY = 0.f;
+  bool hasPoints = false;
+  for (const Contour& contour : contours) {
+    for (const OutlinePoint& point : contour) {
+      minX = hasPoints ? std::min(minX, point.x) : point.x;
+      maxX = hasPoints ? std::max(maxX, point.x) : point.x;
+      minY = hasPoints ? std::min(minY, point.y) : point.y;
+      maxY = hasPoints ? std::max(maxY, point.y) : point.y;
+      hasPoints = true;
+    }
+  }
+
+  // whitespace glyphs have only an advance
+  if (!hasPoints) {
+    return ErrorCode::SUCCESS;
+  }
+
+  const float left = std::floor(minX * scale);
+  const float right = std::ceil(maxX * scale);
+  const float top = std::ceil(maxY * scale);
+  const float bottom = std::floor(minY * scale);
+  if ((static_cast<float>(MAX_GLYPH_DIMENSION) < (right - left)) ||
+      (static_cast<float>(MAX_GLYPH_DIMENSION) < (top - bottom))) {
+    LOGERR("Error, glyph: %u of font: %s is too big", glyphIdx,
+           _fileName.c_str());
+    return ErrorCode::FAILURE;
+  }
+
+  outGlyph.bearingX = static_cast<int32_t>(left);
+  outGlyph.bearingY = static_cast<int32_t>(top);
+  outGlyph.width = static_cast<uint32_t>(right - left);
+  outGlyph.height = static_cast<uint32_t>(top - bottom);
+  if ((0 == outGlyph.width) || (0 == outGlyph.height)) {
+    outGlyph.width = 0;
+    outGlyph.height = 0;
+    return ErrorCode::SUCCESS;
+  }
+
+  // font units (y up) -> bitmap pixels (y down)
+  auto toPixels = [&](const OutlinePoint& point) {
+    return Point { (point.x * scale) - left, top - (point.y * scale) };
+  };
+  auto midPoint = [](const Point& lhs, const Point& rhs) {
+    return Point { 0.5f * (lhs.x + rhs.x), 0.5f * (lhs.y + rhs.y) };
+  };
+
+  const size_t pixelsCount =
+      static_cast<size_t>(outGlyph.width) * outGlyph.height;
+  // the extra cells absorb the right edge contributions of the last row
+  std::vector<float> accumulation(pixelsCount + 2, 0.f);
+
+  for (const Contour& contour : contours) {
+    const size_t pointsCount = contour.size();
+    if (2 > pointsCount) {
+      continue;
+    }
+
+    // the contour starts from an on-curve point. When every point is
+    // off-curve - from the implied on-curve point between the first two
+    size_t startIdx = 0;
+    while ((startIdx < pointsCount) && !contour[startIdx].onCurve) {
+      ++startIdx;
+    }
+
+    Point start;
+    size_t firstIdx = 0;
+    if (pointsCount == startIdx) {
+      start = midPoint(toPixels(contour[pointsCount - 1]),
+                       toPixels(contour[0]));
+    } else {
+      start = toPixels(contour[startIdx]);
+      firstIdx = startIdx + 1;
+    }
+
+    Point current = start;
+    Point control;
+    bool hasControl = false;
+    auto visit = [&](const Point& point, const bool onCurve) {
+      if (onCurve) {
+        if (hasControl) {
+          accumulateQuadratic(current, control, point, outGlyph.width,
+                              outGlyph.height, accumulation);
+        } else {
+          accumulateLine(current, point, outGlyph.width, outGlyph.height,
+                         accumulation);
+        }
+        current = point;
+        hasControl = false;
+        return;
+      }
+
+      // two consecutive off-curve points imply an on-curve point between
+      if (hasControl) {
+        const Point implied = midPoint(control, point);
+        accumulateQuadratic(current, control, implied, outGlyph.width,
+                            outGlyph.height, accumulation);
+        current = implied;
+      }
+      control = point;
+      hasControl = true;
+    };
+
+    const size_t visitsCount = (pointsCount == startIdx)
+        ? pointsCount : (pointsCount - 1);
+    for (size_t i = 0; i < visitsCount; ++i) {
+      const OutlinePoint& point = contour[(firstIdx + i) % pointsCount];
+      visit(toPixels(point), point.onCurve);
+    }
+    visit(start, true);
+  }
+
+  outGlyph.coverage.resize(pixelsCount);
+  float coverage = 0.f;
+  for (size_t i = 0; i < pixelsCount; ++i) {
+    coverage += accumulation[i];
+    const float value = std::min(1.f, std::fabs(coverage));
+    outGlyph.coverage[i] = static_cast<uint8_t>(std::lround(value * 255.f));
+  }
+
+  return ErrorCode::SUCCESS;
+}
+
+ErrorCode TrueTypeFont::locateTables() {
+  if (SFNT_HEADER_SIZE > _data.size()) {
+    LOGERR("Error, font: %s is too small", _fileName.c_str());
+    return ErrorCode::FAILURE;
+  }
+
+  // font collections - the first font is used
+  size_t fontOffset = 0;
+  if (0 == memcmp(_data.data(), "ttcf", 4)) {
+    if (TTC_HEADER_SIZE > _data.size()) {
+      LOGERR("Error, font: %s has invalid font collection header",
+             _fileName.c_str());
+      return ErrorCode::FAILURE;
+    }
+    fontOffset = readU32(12);
+  }
+
+  if ((fontOffset + SFNT_HEADER_SIZE) > _data.size()) {
+    LOGERR("Error, font: %s has truncated header", _fileName.c_str());
+    return ErrorCode::FAILURE;
+  }
+
+  if (0 == memcmp(&_data[fontOffset], "OTTO", 4)) {
+    LOGERR("Error, font: %s has CFF outlines, which are not supported. "
+           "Only 'glyf' outlines can be rasterized", _fileName.c_str());
+    return ErrorCode::FAILURE;
+  }
+
+  struct TableLocation {
+    const char* tag;
+    size_t minSize;
+    size_t* offset;
+    size_t* size;
+  };
+  size_t headSize = 0;
+  size_t hheaSize = 0;
+  size_t maxpSize = 0;
+  const TableLocation tables[] = {
+      { "head", HEAD_TABLE_MIN_SIZE, &_headOffset, &headSize },
+      { "hhea", HHEA_TABLE_MIN_SIZE, &_hheaOffset, &hheaSize },
+      { "maxp", MAXP_TABLE_MIN_SIZE, &_maxpOffset, &maxpSize },
+      { "hmtx", 4, &_hmtxOffset, &_hmtxSize },
+      { "loca", 2, &_locaOffset, &_locaSize },
+      { "glyf", 0, &_glyfOffset, &_glyfSize },
+      { "cmap", 4, &_cmapOffset, &_cmapSize } };
+
+  const size_t tablesCount = readU16(fontOffset + 4);
+  for (const TableLocation& table : tables) {
+    bool isFound = false;
+    for (size_t i = 0; i < tablesCount; ++i) {
+      const size_t record =
+          fontOffset + SFNT_HEADER_SIZE + (i * SFNT_TABLE_RECORD_SIZE);
+      if ((record + SFNT_TABLE_RECORD_SIZE) > _data.size()) {
+        break;
+      }
+      if (0 != memcmp(&_data[record], table.tag, 4)) {
+        continue;
+      }
+
+      const size_t offset = readU32(record + 8);
+      const size_t size = readU32(record + 12);
+      if ((offset + size > _data.size()) || (table.minSize > size)) {
+        LOGERR("Error, font: %s has truncated '%s' table", _fileName.c_str(),
+               table.tag);
+        return ErrorCode::FAILURE;
+      }
+      *table.offset = offset;
+      *table.size = size;
+      isFound = true;
+      break;
+    }
+
+    if (!isFound) {
+      LOGERR("Error, font: %s has no '%s' table", _fileName.c_str(),
+             table.tag);
+      return ErrorCode::FAILURE;
+    }
+  }
+
+  _unitsPerEm = readU16(_headOffset + 18);
+  _isLongLocaFormat = (0 != readS16(_headOffset + 50));
+  _glyphCount = readU16(_maxpOffset + 4);
+  _horizontalMetricsCount = readU16(_hheaOffset + 34);
+
+  if ((0 == _unitsPerEm) || (0 == _glyphCount) ||
+      (0 == _horizontalMetricsCount) ||
+      ((4 * static_cast<size_t>(_horizontalMetricsCount)) > _hmtxSize)) {
+    LOGERR("Error, font: %s has invalid metrics", _fileName.c_str());
+    return ErrorCode::FAILURE;
+  }
+
+  const size_t locaEntrySize = _isLongLocaFormat ? 4 : 2;
+  if ((locaEntrySize * (static_cast<size_t>(_glyphCount) + 1)) > _locaSize) {
+    LOGERR("Error, font: %s has truncated 'loca' table", _fileName.c_str());
+    return ErrorCode::FAILURE;
+  }
+
+  return ErrorCode::SUCCESS;
+}
+
+ErrorCode TrueTypeFont::selectCharacterMap() {
+  const size_t recordsCount = readU16(_cmapOffset + 2);
+  uint32_t bestScore = 0;
+
+  for (size_t i = 0; i < recordsCount; ++i) {
+    const size_t record = _cmapOffset + 4 + (i * CMAP_RECORD_SIZE);
+    if ((record + CMAP_RECORD_SIZE) > (_cmapOffset + _cmapSize)) {
+      break;
+    }
+
+    const uint16_t platformId = readU16(record);
+    const uint16_t encodingId = readU16(record + 2);
+    const bool isUnicode = (0 == platformId) ||
+        ((3 == platformId) && ((1 == encodingId) || (10 == encodingId)));
+    if (!isUnicode) {
+      continue;
+    }
+
+    const size_t subtableOffset = _cmapOffset + readU32(record + 4);
+    const uint16_t format = readU16(subtableOffset);
+
+    // format 12 covers the full unicode range
+    uint32_t score = 0;
+    if (12 == format) {
+      score = 2;
+    } else if (4 == format) {
+      score = 1;
+    }
+
+    if (score > bestScore) {
+      bestScore = score;
+      _charMapOffset = subtableOffset;
+      _charMapFormat = format;
+    }
+  }
+
+  if (0 == bestScore) {
+    LOGERR("Error, font: %s has no unicode character map in format 4 or 12",
+           _fileName.c_str());
+    return ErrorCode::FAILURE;
+  }
+
+  return ErrorCode::SUCCESS;
+}
+
+bool TrueTypeFont::getGlyphRange(const uint32_t glyphIdx, size_t& outOffset,
+                                 size_t& outSize) const {
+  if (glyphIdx >= _glyphCount) {
+    return false;
+  }
+
+  size_t begin = 0;
+  size_t end = 0;
+  if (_isLongLocaFormat) {
+    begin = readU32(_locaOffset + (4 * static_cast<size_t>(glyphIdx)));
+    end = readU32(_locaOffset + (4 * static_cast<size_t>(glyphIdx + 1)));
+  } else {
+    begin = 2 * static_cast<size_t>(
+        readU16(_locaOffset + (2 * static_cast<size_t>(glyphIdx))));
+    end = 2 * static_cast<size_t>(
+        readU16(_locaOffset + (2 * static_cast<size_t>(glyphIdx + 1))));
+  }
+
+  if ((begin > end) || (end > _glyfSize)) {
+    return false;
+  }
+
+  outOffset = _glyfOffset + begin;
+  outSize = end - begin;
+  return true;
+}
+
+ErrorCode TrueTypeFont::appendGlyphContours(
+    const uint32_t glyphIdx, const Transform& transform, const uint32_t depth,
+    std::vector<Contour>& outContours) const {
+  size_t glyphOffset = 0;
+  size_t glyphSize = 0;
+  if (!getGlyphRange(glyphIdx, glyphOffset, glyphSize)) {
+    LOGERR("Error, invalid location of glyph: %u", glyphIdx);
+    return ErrorCode::FAILURE;
+  }
+
+  // empty glyph
+  if (0 == glyphSize) {
+    return ErrorCode::SUCCESS;
+  }
+
+  if (GLYPH_HEADER_SIZE > glyphSize) {
+    LOGERR("Error, truncated glyph: %u", glyphIdx);
+    return ErrorCode::FAILURE;
+  }
+
+  const int16_t contoursCount = readS16(glyphOffset);
+  if (0 <= contoursCount) {
+    return appendSimpleGlyphContours(glyphOffset, glyphSize, contoursCount,
+                                     transform, outContours);
+  }
+
+  if (MAX_COMPOSITE_DEPTH <= depth) {
+    LOGERR("Error, composite glyph: %u is nested too deep", glyphIdx);
+    return ErrorCode::FAILURE;
+  }
+
+  return appendCompositeGlyphContours(glyphOffset, glyphSize, transform,
+                                      depth, outContours);
+}
+
+ErrorCode TrueTypeFont::appendSimpleGlyphContours(
+    const size_t glyphOffset, const size_t glyphSize,
+    const int32_t contoursCount, const Transform& transform,
+    std::vector<Contour>& outContours) const {
+  size_t cursor = glyphOffset + GLYPH_HEADER_SIZE;
+  const size_t glyphEnd = glyphOffset + glyphSize;
+
+  std::vector<uint16_t> contourEnds(static_cast<size_t>(contoursCount));
+  for (uint16_t& contourEnd : contourEnds) {
+    contourEnd = readU16(cursor);
+    cursor += 2;
+  }
+
+  if (contourEnds.empty()) {
+    return ErrorCode::SUCCESS;
+  }
+
+  const size_t pointsCount = static_cast<size_t>(contourEnds.back()) + 1;
+  const uint16_t instructionsSize = readU16(cursor);
+  cursor += 2 + instructionsSize;
+
+  std::vector<uint8_t> flags(pointsCount);
+  for (size_t i = 0; i < pointsCount;) {
+    const uint8_t flag = readU8(cursor++);
+    uint32_t repeats = 0;
+    if (0 != (flag & FLAG_REPEAT)) {
+      repeats = readU8(cursor++);
+    }
+
+    for (uint32_t j = 0; (j <= repeats) && (i < pointsCount); ++j) {
+      flags[i++] = flag;
+    }
+  }
+
+  auto readCoordinates = [&](const uint8_t shortFlag,
+                             const uint8_t sameOrPositiveFlag,
+                             std::vector<int32_t>& outCoordinates) {
+    outCoordinates.resize(pointsCount);
+    int32_t value = 0;
+    for (size_t i = 0; i < pointsCount; ++i) {
+      const uint8_t flag = flags[i];
+      if (0 != (flag & shortFlag)) {
+        const int32_t delta = readU8(cursor++);
+        value += (0 != (flag & sameOrPositiveFlag)) ? delta : -delta;
+      } else if (0 == (flag & sameOrPositiveFlag)) {
+        value += readS16(cursor);
+        cursor += 2;
+      }
+      outCoordinates[i] = value;
+    }
+  };
+
+  std::vector<int32_t> xCoordinates;
+  std::vector<int32_t> yCoordinates;
+  readCoordinates(FLAG_X_SHORT, FLAG_X_SAME_OR_POSITIVE, xCoordinates);
+  readCoordinates(FLAG_Y_SHORT, FLAG_Y_SAME_OR_POSITIVE, yCoordinates);
+
+  if (cursor > glyphEnd) {
+    LOGERR("Error, glyph data is truncated");
+    return ErrorCode::FAILURE;
+  }
+
+  size_t pointIdx = 0;
+  for (const uint16_t contourEnd : contourEnds) {
+    if ((contourEnd < pointIdx) || (contourEnd >= pointsCount)) {
+      LOGERR("Error, glyph has invalid contour end points");
+      return ErrorCode::FAILURE;
+    }
+
+    Contour contour;
+    contour.reserve(contourEnd - pointIdx + 1);
+    for (; pointIdx <= contourEnd; ++pointIdx) {
+      const float x = static_cast<float>(xCoordinates[pointIdx]);
+      const float y = static_cast<float>(yCoordinates[pointIdx]);
+      OutlinePoint point;
+      point.x = (transform.a * x) + (transform.c * y) + transform.e;
+      point.y = (transform.b * x) + (transform.d * y) + transform.f;
+      point.onCurve = (0 != (flags[pointIdx] & FLAG_ON_CURVE));
+      contour.push_back(point);
+    }
+    outContours.push_back(std::move(contour));
+  }
+
+  return ErrorCode::SUCCESS;
+}
+
+ErrorCode TrueTypeFont::appendCompositeGlyphContours(
+    const size_t glyphOffset, const size_t glyphSize,
+    const Transform& transform, const uint32_t depth,
+    std::vector<Contour>& outContours) const {
+  size_t cursor = glyphOffset + GLYPH_HEADER_SIZE;
+  const size_t glyphEnd = glyphOffset + glyphSize;
+  auto readF2Dot14 = [this](const size_t offset) {
+    return static_cast<float>(readS16(offset)) * F2DOT14_SCALE;
+  };
+
+  uint16_t flags = COMPOSITE_MORE_COMPONENTS;
+  while (0 != (flags & COMPOSITE_MORE_COMPONENTS)) {
+    if ((cursor + 4) > glyphEnd) {
+      LOGERR("Error, composite glyph data is truncated");
+      return ErrorCode::FAILURE;
+    }
+
+    flags = readU16(cursor);
+    const uint16_t componentIdx = readU16(cursor + 2);
+    cursor += 4;
+
+    Transform component;
+    if (0 != (flags & COMPOSITE_ARGS_ARE_WORDS)) {
+      component.e = static_cast<float>(readS16(cursor));
+      component.f = static_cast<float>(readS16(cursor + 2));
+      cursor += 4;
+    } else {
+      component.e = static_cast<float>(static_cast<int8_t>(readU8(cursor)));
+      component.f =
+          static_cast<float>(static_cast<int8_t>(readU8(cursor + 1)));
+      cursor += 2;
+    }
+
+    // point matching placement is not supported - components are placed
+    // at the origin of the composite glyph
+    if (0 == (flags & COMPOSITE_ARGS_ARE_XY_VALUES)) {
+      component.e = 0.f;
+      component.f = 0.f;
+    }
+
+    if (0 != (flags & COMPOSITE_HAVE_SCALE)) {
+      component.a = readF2Dot14(cursor);
+      component.d = component.a;
+      cursor += 2;
+    } else if (0 != (flags & COMPOSITE_HAVE_XY_SCALE)) {
+      component.a = readF2Dot14(cursor);
+      component.d = readF2Dot14(cursor + 2);
+      cursor += 4;
+    } else if (0 != (flags & COMPOSITE_HAVE_2X2)) {
+      component.a = readF2Dot14(cursor);
+      component.b = readF2Dot14(cursor + 2);
+      component.c = readF2Dot14(cursor + 4);
+      component.d = readF2Dot14(cursor + 6);
+      cursor += 8;
+    }
+
+    // the parent transformation is applied on top of the component one
+    Transform combined;
+    combined.a = (transform.a * component.a) + (transform.c * component.b);
+    combined.b = (transform.b * component.a) + (transform.d * component.b);
+    combined.c = (transform.a * component.c) + (transform.c * component.d);
+    combined.d = (transform.b * component.c) + (transform.d * component.d);
+    combined.e = (transform.a * component.e) + (transform.c * component.f) +
+                 transform.e;
+    combined.f = (transform.b * component.e) + (transform.d * component.f) +
+                 transform.f;
+
+    if (ErrorCode::SUCCESS != appendGlyphContours(componentIdx, combined,
+                                                  depth + 1, outContours)) {
+      LOGERR("Error, appendGlyphContours() failed for component: %u",
+             componentIdx);
+      return ErrorCode::FAILURE;
+    }
+  }
+
+  return ErrorCode::SUCCESS;
+}
+
+uint8_t TrueTypeFont::readU8(const size_t offset) const {
+  return (offset < _data.size()) ? _data[offset] : 0;
+}
+
+uint16_t TrueTypeFont::readU16(const size_t offset) const {
+  return static_cast<uint16_t>((readU8(offset) << 8) | readU8(offset + 1));
+}
+
+int16_t TrueTypeFont::readS16(const size_t offset) const {
+  return static_cast<int16_t>(readU16(offset));
+}
+
+uint32_t TrueTypeFont::readU32(const size_t offset) const {
+  return (static_cast<uint32_t>(readU16(offset)) << 16) | readU16(offset + 2);
+}
@@ -1,6 +1,4 @@
 // System headers
-#include <string>
-#include <vector>
 #include <cstdlib>
 
 // Other libraries headers
@@ -8,29 +6,30 @@
 #include "utils/log/Log.h"
 
 // Own components headers
+#include "resource_builder/CommandLineParser.h"
+#include "resource_builder/ResourceBuilderConfig.h"
+#include "resource_builder/ReproducibilityVerifier.h"
 #include "resource_builder/ResourceParser.h"
 
 int32_t main(const int32_t argc, const char *args[]) {
-  if (1 >= argc) {
-    LOGERR("Resource Builder tool expects a list a project folder names within "
-        "the root project folder to parse");
+  ResourceBuilderConfig config;
+  if (ErrorCode::SUCCESS != CommandLineParser::parse(argc, args, config)) {
+    CommandLineParser::printUsage();
     return EXIT_FAILURE;
   }
 
-  const std::vector<std::string> supportedProjects = [argc, args](){
-    std::vector<std::string> projects(argc - 1);
-    for (int32_t i = 1; i < argc; ++i) {
-      projects[i - 1] = args[i];
-    }
-    return projects;
-  }();
+  if (config.verifyReproducible &&
+      (ErrorCode::SUCCESS != ReproducibilityVerifier::verify(config))) {
+    LOGERR("Error, identical inputs did not produce identical outputs");
+    return EXIT_FAILURE;
+  }
 
   ResourceParser parser;
-  if (ErrorCode::SUCCESS != parser.init()) {
+  if (ErrorCode::SUCCESS != parser.init(config)) {
     return EXIT_FAILURE;
   }
 
-  for (const auto & project : supportedProjects) {
+  for (const auto & project : config.projectNames) {
     if (ErrorCode::SUCCESS != parser.parseResourceTree(project)) {
       LOGERR("Error in parser.parseResourceTree() for project: %s",
           project.c_str());